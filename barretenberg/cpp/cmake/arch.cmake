@@ -3,6 +3,12 @@ if(WASM)
     # 2m:18s to compile scalar_multiplication.cpp, and with it on I estimate it's 50-100 times longer. I never
     # had the patience to wait it out...
     add_compile_options(-fno-exceptions -fno-slp-vectorize)
+    if(WASM_SIMD)
+        # Lets the loop vectorizer use 128 bit lanes. Needs a runtime with fixed width SIMD (any browser since 2021).
+        # Off by default until scripts/benchmark_wasm_vs_native.sh (with WASM_SIMD=1) shows it is a win.
+        message(STATUS "WASM SIMD128 is enabled.")
+        add_compile_options(-msimd128)
+    endif()
 endif()
 
 if(NOT WASM AND NOT APPLE AND NOT ARM)
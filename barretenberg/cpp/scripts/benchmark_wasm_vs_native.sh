@@ -0,0 +1,39 @@
+#!/usr/bin/env bash
+# Runs a benchmark natively and as threaded WASM under wasmtime, then compares the two with google benchmark's
+# compare.py (numbers are the change going from native to WASM).
+set -eu
+
+BENCHMARK=${1:-prover_kernels_bench}
+FILTER=${2:-.}
+HARDWARE_CONCURRENCY=${HARDWARE_CONCURRENCY:-16}
+
+# Move above script dir.
+cd $(dirname $0)/..
+
+RESULTS_DIR=$(mktemp -d)
+trap "rm -rf $RESULTS_DIR" EXIT
+
+# Native.
+cmake --preset clang16
+cmake --build --preset clang16 --target $BENCHMARK
+(cd build && HARDWARE_CONCURRENCY=$HARDWARE_CONCURRENCY ./bin/$BENCHMARK --benchmark_filter=$FILTER \
+  --benchmark_format=json > $RESULTS_DIR/native.json)
+
+# WASM, with the same number of threads.
+cmake --preset wasm-threads
+cmake --build --preset wasm-threads --target $BENCHMARK
+(cd build-wasm-threads && wasmtime run --env HARDWARE_CONCURRENCY=$HARDWARE_CONCURRENCY -Wthreads=y -Sthreads=y \
+  --dir=.. ./bin/$BENCHMARK --benchmark_filter=$FILTER --benchmark_format=json > $RESULTS_DIR/wasm.json)
+
+pip3 install --user -r build/_deps/benchmark-src/requirements.txt > /dev/null
+build/_deps/benchmark-src/tools/compare.py benchmarks $RESULTS_DIR/native.json $RESULTS_DIR/wasm.json
+
+# With WASM_SIMD=1, also build WASM with -msimd128 and compare it against the plain WASM build.
+if [ "${WASM_SIMD:-0}" -eq 1 ]; then
+  cmake --preset wasm-threads -B build-wasm-threads-simd -DWASM_SIMD=ON
+  cmake --build build-wasm-threads-simd --target $BENCHMARK
+  (cd build-wasm-threads-simd && wasmtime run --env HARDWARE_CONCURRENCY=$HARDWARE_CONCURRENCY -Wthreads=y \
+    -Sthreads=y --dir=.. ./bin/$BENCHMARK --benchmark_filter=$FILTER --benchmark_format=json \
+    > $RESULTS_DIR/wasm_simd.json)
+  build/_deps/benchmark-src/tools/compare.py benchmarks $RESULTS_DIR/wasm.json $RESULTS_DIR/wasm_simd.json
+fi
@@ -3,6 +3,7 @@
 #include "barretenberg/dsl/types.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
+#include "barretenberg/proof_system/plookup_tables/plookup_tables.hpp"
 #include "barretenberg/vm/avm_trace/avm_execution.hpp"
 #include "config.hpp"
 #include "get_bn254_crs.hpp"
@@ -491,6 +492,9 @@ int main(int argc, char* argv[])
         std::string vk_path = get_option(args, "-k", "./target/vk");
         std::string pk_path = get_option(args, "-r", "./target/pk");
         CRS_PATH = get_option(args, "-c", CRS_PATH);
+        if (flag_present(args, "--lookup_table_cache_dir")) {
+            plookup::set_basic_table_cache_dir(get_option(args, "--lookup_table_cache_dir", ""));
+        }
 
         // Skip CRS initialization for any command which doesn't require the CRS.
         if (command == "--version") {
@@ -77,6 +77,28 @@ BENCHMARK_DEFINE_F(GoblinBench, GoblinFull)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Benchmark the full Goblin IVC protocol with the ECCVM prover and translator precomputation run concurrently
+ *
+ */
+BENCHMARK_DEFINE_F(GoblinBench, GoblinFullConcurrent)(benchmark::State& state)
+{
+    Goblin goblin;
+
+    // TODO(https://github.com/AztecProtocol/barretenberg/issues/723)
+    GoblinMockCircuits::perform_op_queue_interactions_for_mock_first_circuit(goblin.op_queue);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        perform_goblin_accumulation_rounds(state, goblin);
+
+        goblin.prove_concurrent();
+    }
+    state.counters["eccvm_ms"] = static_cast<double>(goblin.stage_timings.eccvm);
+    state.counters["translator_precompute_ms"] = static_cast<double>(goblin.stage_timings.translator_precompute);
+    state.counters["translator_ms"] = static_cast<double>(goblin.stage_timings.translator);
+}
+
 /**
  * @brief Benchmark only the accumulation rounds
  *
@@ -146,6 +168,7 @@ BENCHMARK_DEFINE_F(GoblinBench, GoblinTranslatorProve)(benchmark::State& state)
         ->Arg(1 << 6)
 
 BENCHMARK_REGISTER_F(GoblinBench, GoblinFull)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(GoblinBench, GoblinFullConcurrent)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(GoblinBench, GoblinAccumulate)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(GoblinBench, GoblinECCVMProve)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(GoblinBench, GoblinTranslatorProve)->Unit(benchmark::kMillisecond)->ARGS;
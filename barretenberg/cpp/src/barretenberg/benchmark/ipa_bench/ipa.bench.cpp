@@ -13,7 +13,8 @@ constexpr size_t MAX_POLYNOMIAL_DEGREE_LOG2 = 16;
 std::shared_ptr<bb::srs::factories::CrsFactory<curve::Grumpkin>> crs_factory(
     new bb::srs::factories::FileCrsFactory<curve::Grumpkin>("../srs_db/grumpkin", 1 << 16));
 
-auto ck = std::make_shared<CommitmentKey<Curve>>(1 << MAX_POLYNOMIAL_DEGREE_LOG2);
+auto ck = std::make_shared<CommitmentKey<Curve>>(1 << MAX_POLYNOMIAL_DEGREE_LOG2,
+                                                 crs_factory->get_prover_crs(1 << MAX_POLYNOMIAL_DEGREE_LOG2));
 auto vk = std::make_shared<VerifierCommitmentKey<Curve>>(1 << MAX_POLYNOMIAL_DEGREE_LOG2, crs_factory);
 
 std::vector<std::shared_ptr<NativeTranscript>> prover_transcripts(MAX_POLYNOMIAL_DEGREE_LOG2 -
@@ -60,7 +61,46 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+/**
+ * @brief Verify a batch of proofs with a single MSM against the SRS, reporting the amortized verifier throughput
+ *
+ */
+void ipa_batch_verify(State& state) noexcept
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t n = 1 << static_cast<size_t>(state.range(0));
+    const auto num_proofs = static_cast<size_t>(state.range(1));
+    std::vector<OpeningClaim<Curve>> batch_opening_claims;
+    std::vector<HonkProof> proofs;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        Polynomial<Fr> poly(n);
+        for (size_t j = 0; j < n; ++j) {
+            poly[j] = Fr::random_element(&engine);
+        }
+        auto x = Fr::random_element(&engine);
+        const OpeningPair<Curve> opening_pair = { x, poly.evaluate(x) };
+        batch_opening_claims.push_back({ opening_pair, ck->commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA<Curve>::compute_opening_proof(ck, opening_pair, poly, prover_transcript);
+        proofs.push_back(prover_transcript->proof_data);
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (const auto& proof : proofs) {
+            verifier_transcripts.push_back(std::make_shared<NativeTranscript>(proof));
+        }
+        state.ResumeTiming();
+        auto result = IPA<Curve>::batch_verify(vk, batch_opening_claims, verifier_transcripts);
+        ASSERT(result);
+    }
+    state.counters["proofs_per_second"] = Counter(static_cast<double>(num_proofs), Counter::kIsIterationInvariantRate);
+}
 } // namespace
 BENCHMARK(ipa_open)->Unit(kMillisecond)->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2);
 BENCHMARK(ipa_verify)->Unit(kMillisecond)->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2);
+BENCHMARK(ipa_batch_verify)
+    ->Unit(kMillisecond)
+    ->ArgsProduct({ { MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2 }, { 1, 8, 32 } });
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "barretenberg/benchmark/ultra_bench/mock_proofs.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+#include "barretenberg/protogalaxy/protogalaxy_prover_impl.hpp"
 #include "barretenberg/ultra_honk/ultra_composer.hpp"
 
 using namespace benchmark;
@@ -43,8 +44,54 @@ template <typename Composer> void fold_one(State& state) noexcept
     }
 }
 
+// Fold k instances into an accumulator at once, reporting the amortized cost of folding each of them.
+template <typename Composer, size_t k> void fold_k(State& state) noexcept
+{
+    using Flavor = typename Composer::Flavor;
+    using Instance = ProverInstance_<Flavor>;
+    using Instances = ProverInstances_<Flavor, k + 1>;
+    using ProtoGalaxyProver = ProtoGalaxyProver_<Instances>;
+    using Builder = typename Flavor::CircuitBuilder;
+
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+    Composer composer;
+
+    const auto construct_instance = [&]() {
+        Builder builder;
+        if constexpr (std::same_as<Flavor, GoblinUltraFlavor>) {
+            GoblinMockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+        } else {
+            static_assert(std::same_as<Flavor, UltraFlavor>);
+            bb::mock_proofs::generate_basic_arithmetic_circuit(builder, log2_num_gates);
+        }
+        return composer.create_prover_instance(builder);
+    };
+
+    std::vector<std::shared_ptr<Instance>> instances;
+    for (size_t idx = 0; idx < k + 1; idx++) {
+        instances.emplace_back(construct_instance());
+    }
+
+    ProtoGalaxyProver folding_prover(instances);
+
+    for (auto _ : state) {
+        auto proof = folding_prover.fold_instances();
+    }
+    state.counters["time_per_instance"] =
+        Counter(static_cast<double>(k), Counter::kIsIterationInvariantRate | Counter::kInvert);
+}
+
 BENCHMARK(fold_one<UltraComposer>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
 BENCHMARK(fold_one<GoblinUltraComposer>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
+
+// Fold k = 1, 3, 7, 15 instances at once; the number of instances in memory limits the circuit sizes
+BENCHMARK(fold_k<UltraComposer, 1>)->/* vary the circuit size */ DenseRange(14, 16)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraComposer, 3>)->/* vary the circuit size */ DenseRange(14, 16)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraComposer, 7>)->/* vary the circuit size */ DenseRange(14, 16)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraComposer, 15>)->/* vary the circuit size */ DenseRange(14, 16)->Unit(kMillisecond);
+BENCHMARK(fold_k<GoblinUltraComposer, 3>)->/* vary the circuit size */ DenseRange(14, 16)->Unit(kMillisecond);
 } // namespace bb
 
 BENCHMARK_MAIN();
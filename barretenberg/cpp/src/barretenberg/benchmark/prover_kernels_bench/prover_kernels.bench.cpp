@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/benchmark/ultra_bench/mock_proofs.hpp"
+#include "barretenberg/commitment_schemes/commitment_key.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+// The kernels that dominate proving time (MSM, FFT) plus a full UltraHonk proof, at a few sizes. Built and run both
+// natively and as WASM by scripts/benchmark_wasm_vs_native.sh to compare the two.
+namespace {
+
+constexpr size_t MIN_LOG_SIZE = 14;
+constexpr size_t MAX_LOG_SIZE = 18;
+
+Polynomial<fr> random_polynomial(const size_t size)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    Polynomial<fr> poly(size);
+    for (size_t i = 0; i < size; ++i) {
+        poly[i] = fr::random_element(&engine);
+    }
+    return poly;
+}
+
+/**
+ * @brief Commit to a random polynomial with 2**n coefficients (a pippenger MSM over the BN254 SRS)
+ */
+void msm(State& state) noexcept
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    const size_t size = 1UL << static_cast<size_t>(state.range(0));
+    CommitmentKey<curve::BN254> commitment_key(size);
+    auto poly = random_polynomial(size);
+    for (auto _ : state) {
+        DoNotOptimize(commitment_key.commit(poly));
+    }
+}
+
+/**
+ * @brief Forward FFT of a polynomial with 2**n coefficients
+ */
+void fft(State& state) noexcept
+{
+    const size_t size = 1UL << static_cast<size_t>(state.range(0));
+    EvaluationDomain<fr> domain(size);
+    domain.compute_lookup_table();
+    auto poly = random_polynomial(size);
+    for (auto _ : state) {
+        poly.fft(domain);
+    }
+}
+
+/**
+ * @brief Coset FFT over 4x the size of a polynomial with 2**n coefficients, as used by the Plonk quotient
+ */
+void coset_fft(State& state) noexcept
+{
+    const size_t size = 1UL << static_cast<size_t>(state.range(0));
+    EvaluationDomain<fr> large_domain(4 * size);
+    large_domain.compute_lookup_table();
+    auto poly = random_polynomial(4 * size);
+    for (auto _ : state) {
+        poly.coset_fft(large_domain);
+    }
+}
+
+/**
+ * @brief Full UltraHonk proof of a circuit of 2**n basic arithmetic gates
+ */
+void ultra_honk_proof(State& state) noexcept
+{
+    bb::mock_proofs::construct_proof_with_specified_num_iterations<UltraComposer>(
+        state,
+        &bb::mock_proofs::generate_basic_arithmetic_circuit<UltraCircuitBuilder>,
+        static_cast<size_t>(state.range(0)));
+}
+
+} // namespace
+
+BENCHMARK(msm)->DenseRange(MIN_LOG_SIZE, MAX_LOG_SIZE, 2)->Unit(kMillisecond);
+BENCHMARK(fft)->DenseRange(MIN_LOG_SIZE, MAX_LOG_SIZE, 2)->Unit(kMillisecond);
+BENCHMARK(coset_fft)->DenseRange(MIN_LOG_SIZE, MAX_LOG_SIZE - 2, 2)->Unit(kMillisecond);
+BENCHMARK(ultra_honk_proof)->DenseRange(MIN_LOG_SIZE, MAX_LOG_SIZE - 2, 2)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
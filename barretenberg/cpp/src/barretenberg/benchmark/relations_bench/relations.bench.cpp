@@ -39,6 +39,8 @@ BENCHMARK(execute_relation<UltraFlavor, LookupRelation<Fr>>);
 BENCHMARK(execute_relation<UltraFlavor, UltraPermutationRelation<Fr>>);
 
 BENCHMARK(execute_relation<GoblinUltraFlavor, EccOpQueueRelation<Fr>>);
+BENCHMARK(execute_relation<GoblinUltraFlavor, Poseidon2ExternalRelation<Fr>>);
+BENCHMARK(execute_relation<GoblinUltraFlavor, Poseidon2InternalRelation<Fr>>);
 
 BENCHMARK(execute_relation<GoblinTranslatorFlavor, GoblinTranslatorDecompositionRelation<Fr>>);
 BENCHMARK(execute_relation<GoblinTranslatorFlavor, GoblinTranslatorOpcodeConstraintRelation<Fr>>);
@@ -0,0 +1,73 @@
+#include "barretenberg/benchmark/ultra_bench/mock_proofs.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+constexpr size_t LOG2_NUM_GATES = 12;
+
+/**
+ * @brief Verify a batch of UltraPlonk proofs for the same verification key one by one, or with a single pairing check
+ */
+template <bool batched> void verify_ultraplonk_proofs(State& state) noexcept
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    const auto num_proofs = static_cast<size_t>(state.range(0));
+    plonk::UltraComposer composer;
+    UltraCircuitBuilder builder;
+    mock_proofs::generate_basic_arithmetic_circuit(builder, LOG2_NUM_GATES);
+    auto prover = composer.create_prover(builder);
+    auto verifier = composer.create_verifier(builder);
+    // The cost of verification does not depend on the proofs being distinct
+    const std::vector<plonk::proof> proofs(num_proofs, prover.construct_proof());
+
+    for (auto _ : state) {
+        if constexpr (batched) {
+            DoNotOptimize(verifier.batch_verify_proofs(proofs));
+        } else {
+            for (const auto& proof : proofs) {
+                DoNotOptimize(verifier.verify_proof(proof));
+            }
+        }
+    }
+    state.counters["proofs_per_second"] =
+        Counter(static_cast<double>(num_proofs), Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Verify a batch of UltraHonk proofs for the same verification key one by one, or with a single pairing check
+ */
+template <bool batched> void verify_ultrahonk_proofs(State& state) noexcept
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    const auto num_proofs = static_cast<size_t>(state.range(0));
+    UltraComposer composer;
+    UltraCircuitBuilder builder;
+    mock_proofs::generate_basic_arithmetic_circuit(builder, LOG2_NUM_GATES);
+    auto instance = composer.create_prover_instance(builder);
+    auto prover = composer.create_prover(instance);
+    auto verifier = composer.create_verifier(instance->verification_key);
+    const std::vector<HonkProof> proofs(num_proofs, prover.construct_proof());
+
+    for (auto _ : state) {
+        if constexpr (batched) {
+            DoNotOptimize(verifier.batch_verify_proofs(proofs));
+        } else {
+            for (const auto& proof : proofs) {
+                DoNotOptimize(verifier.verify_proof(proof));
+            }
+        }
+    }
+    state.counters["proofs_per_second"] =
+        Counter(static_cast<double>(num_proofs), Counter::kIsIterationInvariantRate);
+}
+
+} // namespace
+
+BENCHMARK(verify_ultraplonk_proofs<false>)->RangeMultiplier(4)->Range(1, 64)->Unit(kMillisecond);
+BENCHMARK(verify_ultraplonk_proofs<true>)->RangeMultiplier(4)->Range(1, 64)->Unit(kMillisecond);
+BENCHMARK(verify_ultrahonk_proofs<false>)->RangeMultiplier(4)->Range(1, 64)->Unit(kMillisecond);
+BENCHMARK(verify_ultrahonk_proofs<true>)->RangeMultiplier(4)->Range(1, 64)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -3,6 +3,7 @@
 #include "barretenberg/benchmark/ultra_bench/mock_proofs.hpp"
 #include "barretenberg/common/op_count_google_bench.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+#include "barretenberg/sumcheck/sumcheck_round.hpp"
 #include "barretenberg/ultra_honk/ultra_composer.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 
@@ -63,7 +64,10 @@ BB_PROFILE static void test_round(State& state, size_t index) noexcept
     GoblinUltraProver prover = bb::mock_proofs::get_prover(
         composer, &bb::mock_proofs::generate_basic_arithmetic_circuit<GoblinUltraCircuitBuilder>, log2_num_gates);
     for (auto _ : state) {
+        // test_round_inner resumes the timer only for the measured round
+        state.PauseTiming();
         test_round_inner(state, prover, index);
+        state.ResumeTiming();
     }
 }
 #define ROUND_BENCHMARK(round)                                                                                         \
@@ -73,6 +77,46 @@ BB_PROFILE static void test_round(State& state, size_t index) noexcept
     }                                                                                                                  \
     BENCHMARK(ROUND_##round)->DenseRange(17, 19)->Unit(kMillisecond)
 
+/**
+ * @details Benchmark the first sumcheck round on its own. It runs over the full trace, so it is the most expensive round
+ * of the relation check and the one that benefits from skipping relations on edges where their selector vanishes.
+ * @param state - The google benchmark state.
+ **/
+BB_PROFILE static void SUMCHECK_FIRST_ROUND(State& state) noexcept
+{
+    using Flavor = GoblinUltraFlavor;
+    using FF = Flavor::FF;
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    GoblinUltraComposer composer;
+    GoblinUltraProver prover = bb::mock_proofs::get_prover(
+        composer, &bb::mock_proofs::generate_basic_arithmetic_circuit<GoblinUltraCircuitBuilder>, log2_num_gates);
+    prover.execute_preamble_round();
+    prover.execute_wire_commitments_round();
+    prover.execute_sorted_list_accumulator_round();
+    prover.execute_log_derivative_inverse_round();
+    prover.execute_grand_product_computation_round();
+
+    const size_t circuit_size = prover.instance->proving_key->circuit_size;
+    Flavor::RelationSeparator alphas;
+    for (auto& alpha : alphas) {
+        alpha = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(numeric::get_msb(circuit_size));
+    for (auto& gate_challenge : gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+    PowPolynomial<FF> pow_polynomial(gate_challenges);
+    pow_polynomial.compute_values();
+
+    for (auto _ : state) {
+        SumcheckProverRound<Flavor> round(circuit_size);
+        DoNotOptimize(round.compute_univariate(
+            prover.instance->prover_polynomials, prover.instance->relation_parameters, pow_polynomial, alphas));
+    }
+}
+
 // Fast rounds take a long time to benchmark because of how we compute statistical significance.
 // Limit to one iteration so we don't spend a lot of time redoing full proofs just to measure this part.
 ROUND_BENCHMARK(PREAMBLE)->Iterations(1);
@@ -82,5 +126,6 @@ ROUND_BENCHMARK(LOG_DERIVATIVE_INVERSE)->Iterations(1);
 ROUND_BENCHMARK(GRAND_PRODUCT_COMPUTATION)->Iterations(1);
 ROUND_BENCHMARK(RELATION_CHECK);
 ROUND_BENCHMARK(ZEROMORPH);
+BENCHMARK(SUMCHECK_FIRST_ROUND)->DenseRange(17, 19)->Unit(kMillisecond);
 
 BENCHMARK_MAIN();
@@ -25,10 +25,13 @@ auto& engine = bb::numeric::get_debug_randomness();
 namespace bb::plonk {
 
 #ifdef GET_PER_ROW_TIME
-constexpr size_t LARGE_DOMAIN_SIZE = 4;
 constexpr size_t WIDGET_BENCH_TEST_CIRCUIT_SIZE = 1 << 16;
 #endif
 
+// The prover leaves the coset evaluations of the last quarter of the 4n coset in the key; the widgets are benchmarked
+// on that quarter, i.e. on circuit size many rows.
+constexpr size_t WIDGET_BENCH_COSET_QUARTER = 3;
+
 struct BasicPlonkKeyAndTranscript {
     std::shared_ptr<proving_key> key;
     transcript::StandardTranscript transcript;
@@ -55,7 +58,7 @@ template <typename Flavor, typename Widget> void execute_widget(::benchmark::Sta
     BasicPlonkKeyAndTranscript data = get_plonk_key_and_transcript();
     Widget widget(data.key);
     for (auto _ : state) {
-        widget.compute_quotient_contribution(bb::fr::random_element(), data.transcript);
+        widget.compute_quotient_contribution(bb::fr::random_element(), data.transcript, WIDGET_BENCH_COSET_QUARTER);
     }
 }
 
@@ -67,11 +70,11 @@ template <typename Widget> void quotient_contribution(::benchmark::State& state)
 #ifdef GET_PER_ROW_TIME
         auto start = std::chrono::high_resolution_clock::now();
 #endif
-        widget.compute_quotient_contribution(bb::fr::random_element(), data.transcript);
+        widget.compute_quotient_contribution(bb::fr::random_element(), data.transcript, WIDGET_BENCH_COSET_QUARTER);
 #ifdef GET_PER_ROW_TIME
         auto end = std::chrono::high_resolution_clock::now();
         auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
-        state.SetIterationTime(elapsed_seconds.count() / (LARGE_DOMAIN_SIZE * WIDGET_BENCH_TEST_CIRCUIT_SIZE));
+        state.SetIterationTime(elapsed_seconds.count() / WIDGET_BENCH_TEST_CIRCUIT_SIZE);
 #endif
     }
 }
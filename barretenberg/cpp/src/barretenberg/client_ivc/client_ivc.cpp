@@ -17,8 +17,9 @@ ClientIVC::ClientIVC()
 void ClientIVC::initialize(ClientCircuit& circuit)
 {
     goblin.merge(circuit); // Construct new merge proof
+    circuit.blocks.set_fixed_block_sizes(trace_structure);
     Composer composer;
-    prover_fold_output.accumulator = composer.create_prover_instance(circuit);
+    prover_fold_output.accumulator = composer.create_prover_instance(circuit, precomputed_cache);
 }
 
 /**
@@ -31,8 +32,9 @@ void ClientIVC::initialize(ClientCircuit& circuit)
 ClientIVC::FoldProof ClientIVC::accumulate(ClientCircuit& circuit)
 {
     goblin.merge(circuit); // Add recursive merge verifier and construct new merge proof
+    circuit.blocks.set_fixed_block_sizes(trace_structure);
     Composer composer;
-    prover_instance = composer.create_prover_instance(circuit);
+    prover_instance = composer.create_prover_instance(circuit, precomputed_cache);
     auto folding_prover = composer.create_folding_prover({ prover_fold_output.accumulator, prover_instance });
     prover_fold_output = folding_prover.fold_instances();
     return prover_fold_output.folding_data;
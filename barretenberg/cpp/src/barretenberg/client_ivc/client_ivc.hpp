@@ -22,6 +22,7 @@ class ClientIVC {
     using ProverAccumulator = std::shared_ptr<ProverInstance_<Flavor>>;
     using VerifierAccumulator = std::shared_ptr<VerifierInstance_<Flavor>>;
     using ProverInstance = ProverInstance_<GoblinUltraFlavor>;
+    using PrecomputedCache = PrecomputedCache_<GoblinUltraFlavor>;
     using VerifierInstance = VerifierInstance_<GoblinUltraFlavor>;
     using ClientCircuit = GoblinUltraCircuitBuilder; // can only be GoblinUltra
 
@@ -53,6 +54,10 @@ class ClientIVC {
     // Note: We need to save the last instance that was folded in order to compute its verification key, this will not
     // be needed in the real IVC as they are provided as inputs
     std::shared_ptr<ProverInstance> prover_instance;
+    // Precomputed polynomials and verification keys shared by all instances of structurally identical circuits
+    std::shared_ptr<PrecomputedCache> precomputed_cache = std::make_shared<PrecomputedCache>();
+    // If set, every circuit is laid out in a structured trace, so that all instances share the same dyadic size
+    TraceStructure trace_structure = TraceStructure::NONE;
 
     ClientIVC();
 
@@ -74,9 +74,11 @@ std::vector<typename bb::Polynomial<typename Curve::ScalarField>> GeminiProver_<
     Polynomial& batched_F = gemini_polynomials.emplace_back(std::move(batched_unshifted));
     Polynomial& batched_G = gemini_polynomials.emplace_back(std::move(batched_to_be_shifted));
     constexpr size_t offset_to_folded = 2; // Offset because of F an G
-    // A₀(X) = F(X) + G↺(X) = F(X) + G(X)/X.
-    Polynomial A_0 = batched_F;
-    A_0 += batched_G.shifted();
+    // A₀(X) = F(X) + G↺(X) = F(X) + G(X)/X is not materialized. The first fold reads it as the sum of F and the shifted
+    // view of G, which shares the memory of G.
+    const Polynomial batched_G_shift = batched_G.shifted();
+    const Fr* F = batched_F.begin();
+    const Fr* G_shift = batched_G_shift.begin();
 
     // Allocate everything before parallel computation
     for (size_t l = 0; l < num_variables - 1; ++l) {
@@ -88,9 +90,9 @@ std::vector<typename bb::Polynomial<typename Curve::ScalarField>> GeminiProver_<
     }
 
     // A_l = Aₗ(X) is the polynomial being folded
-    // in the first iteration, we take the batched polynomial
+    // in the first iteration, we take the batched polynomial A₀ = F + G↺
     // in the next iteration, it is the previously folded one
-    auto A_l = A_0.data();
+    const Fr* A_l = nullptr;
     for (size_t l = 0; l < num_variables - 1; ++l) {
         // size of the previous polynomial/2
         const size_t n_l = 1 << (num_variables - l - 1);
@@ -106,7 +108,7 @@ std::vector<typename bb::Polynomial<typename Curve::ScalarField>> GeminiProver_<
         const Fr u_l = mle_opening_point[l];
 
         // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        auto A_l_fold = gemini_polynomials[l + offset_to_folded].data();
+        Fr* A_l_fold = gemini_polynomials[l + offset_to_folded].begin();
 
         parallel_for(num_used_threads, [&](size_t i) {
             size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
@@ -116,7 +118,13 @@ std::vector<typename bb::Polynomial<typename Curve::ScalarField>> GeminiProver_<
                 // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
                 //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
                 //            = Aₗ₊₁[j]
-                A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
+                if (l == 0) {
+                    const Fr even = F[j << 1] + G_shift[j << 1];
+                    const Fr odd = F[(j << 1) + 1] + G_shift[(j << 1) + 1];
+                    A_l_fold[j] = even + u_l * (odd - even);
+                } else {
+                    A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
+                }
             }
         });
         // set Aₗ₊₁ = Aₗ for the next iteration
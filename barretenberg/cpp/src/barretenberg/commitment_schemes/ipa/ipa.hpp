@@ -2,10 +2,12 @@
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/verification_key.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include <cstddef>
 #include <numeric>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -24,6 +26,29 @@ template <typename Curve> class IPA {
     using VK = VerifierCommitmentKey<Curve>;
     using Polynomial = bb::Polynomial<Fr>;
 
+    // Below this many points the round MSMs use Straus' method on the plain points, which saves building a
+    // Pippenger point table (and spawning threads) for MSMs that are too small to benefit from either.
+    static constexpr size_t STRAUS_THRESHOLD = 16;
+
+    /**
+     * @brief Compute the MSM < scalars, points > of one IPA round
+     *
+     * @param point_table Preallocated space for the Pippenger point table of the points (2 * num_points elements)
+     */
+    static GroupElement round_msm(Fr* scalars,
+                                  Commitment* points,
+                                  Commitment* point_table,
+                                  const size_t num_points,
+                                  scalar_multiplication::pippenger_runtime_state<Curve>& pippenger_runtime_state)
+    {
+        if (num_points <= STRAUS_THRESHOLD) {
+            return scalar_multiplication::straus<Curve>(scalars, points, num_points);
+        }
+        scalar_multiplication::generate_pippenger_point_table<Curve>(points, point_table, num_points);
+        return scalar_multiplication::pippenger<Curve>(
+            scalars, point_table, num_points, pippenger_runtime_state, /*handle_edge_cases=*/false);
+    }
+
   public:
     /**
      * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point
@@ -94,6 +119,16 @@ template <typename Curve> class IPA {
         const size_t num_cpus = get_num_cpus();
         std::vector<Fr> partial_inner_prod_L(num_cpus);
         std::vector<Fr> partial_inner_prod_R(num_cpus);
+
+        // L_i and R_i are independent MSMs of the same size, so we compute them concurrently, each on half of the
+        // available cpus. This needs a second pippenger runtime state, and we preallocate the point tables for both
+        // MSMs once rather than in every round.
+        scalar_multiplication::pippenger_runtime_state<Curve> R_pippenger_runtime_state(poly_degree >> 1);
+        std::vector<Commitment> L_point_table(poly_degree);
+        std::vector<Commitment> R_point_table(poly_degree);
+        // Scratch space for folding G_vec, reused across rounds
+        typename GroupElement::BatchMulScratchSpace fold_scratch_space;
+
         // Perform IPA rounds
         for (size_t i = 0; i < log_poly_degree; i++) {
             round_size >>= 1;
@@ -125,14 +160,26 @@ template <typename Curve> class IPA {
             }
 
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_elements[i] = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[0], &G_vec_local[round_size], round_size, ck->pippenger_runtime_state);
-            L_elements[i] += aux_generator * inner_prod_L;
-
+            const auto compute_L = [&]() {
+                L_elements[i] = round_msm(&a_vec[0],
+                                          &G_vec_local[round_size],
+                                          &L_point_table[0],
+                                          round_size,
+                                          ck->pippenger_runtime_state);
+                L_elements[i] += aux_generator * inner_prod_L;
+            };
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            R_elements[i] = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[round_size], &G_vec_local[0], round_size, ck->pippenger_runtime_state);
-            R_elements[i] += aux_generator * inner_prod_R;
+            const auto compute_R = [&]() {
+                R_elements[i] = round_msm(
+                    &a_vec[round_size], &G_vec_local[0], &R_point_table[0], round_size, R_pippenger_runtime_state);
+                R_elements[i] += aux_generator * inner_prod_R;
+            };
+            if (num_cpus > 1 && round_size > STRAUS_THRESHOLD) {
+                run_tasks_concurrently({ { num_cpus / 2, compute_L }, { num_cpus - num_cpus / 2, compute_R } });
+            } else {
+                compute_L();
+                compute_R();
+            }
 
             std::string index = std::to_string(i);
             transcript->send_to_verifier("IPA:L_" + index, Commitment(L_elements[i]));
@@ -142,11 +189,6 @@ template <typename Curve> class IPA {
             const Fr round_challenge = transcript->get_challenge<Fr>("IPA:round_challenge_" + index);
             const Fr round_challenge_inv = round_challenge.invert();
 
-            auto G_hi = GroupElement::batch_mul_with_endomorphism(
-                std::span{ G_vec_local.begin() + static_cast<long>(round_size),
-                           G_vec_local.begin() + static_cast<long>(round_size * 2) },
-                round_challenge_inv);
-
             // Update the vectors a_vec, b_vec and G_vec.
             // a_vec_next = a_vec_lo + a_vec_hi * round_challenge
             // b_vec_next = b_vec_lo + b_vec_hi * round_challenge_inv
@@ -162,27 +204,68 @@ template <typename Curve> class IPA {
                 /*finite_field_additions_per_iteration=*/4,
                 /*finite_field_multiplications_per_iteration=*/8,
                 /*finite_field_inversions_per_iteration=*/1);
-            GroupElement::batch_affine_add(
-                std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<long>(round_size) },
-                G_hi,
-                G_vec_local);
+            GroupElement::batch_mul_with_endomorphism_and_add(
+                std::span{ G_vec_local.data(), round_size },
+                std::span<const Commitment>{ G_vec_local.data() + round_size, round_size },
+                round_challenge_inv,
+                fold_scratch_space);
         }
 
         transcript->send_to_verifier("IPA:a_0", a_vec[0]);
     }
 
     /**
-     * @brief Verify the correctness of a Proof
+     * @brief An IPA opening claim reduced to the check a_zero⋅<s_vec, G_vec> == commitment
      *
-     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
-     * @param proof The proof containg L_vec, R_vec and a_zero
-     * @param pub_input Data required to verify the proof
+     * @details This is what remains of the verification once the round commitments L_i, R_i have been folded into the
+     * original commitment. s_vec is determined by the round challenges, so the accumulator is small, and the expensive
+     * size-n MSM against the SRS can be deferred and shared between many accumulators (see verify_accumulators).
+     */
+    struct VerifierAccumulator {
+        std::vector<Fr> round_challenges_inv;
+        Fr a_zero;
+        // C_zero - a_zero⋅b_zero⋅aux_generator
+        GroupElement commitment;
+    };
+
+    /**
+     * @brief Compute scale⋅s_vec where s_vec[i] = ∏_{j ∈ [k], bit j of i is set} u_{k-1-j}^{-1}
      *
-     * @return true/false depending on if the proof verifies
+     * @details The entries are computed as a tree of products: the entries with highest set bit j are the entries below
+     * 2^j times u_{k-1-j}^{-1}, so the vector costs one multiplication per entry.
      */
-    static bool verify(const std::shared_ptr<VK>& vk,
-                       const OpeningClaim<Curve>& opening_claim,
-                       const std::shared_ptr<NativeTranscript>& transcript)
+    static std::vector<Fr> compute_s_vec(const std::vector<Fr>& round_challenges_inv, const Fr& scale)
+    {
+        const size_t log_poly_degree = round_challenges_inv.size();
+        std::vector<Fr> s_vec(1UL << log_poly_degree);
+        s_vec[0] = scale;
+        for (size_t j = 0; j < log_poly_degree; j++) {
+            const size_t level_size = 1UL << j;
+            const Fr challenge_inv = round_challenges_inv[log_poly_degree - 1 - j];
+            run_loop_in_parallel_if_effective(
+                level_size,
+                [&s_vec, challenge_inv, level_size](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        s_vec[level_size + i] = s_vec[i] * challenge_inv;
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/0,
+                /*finite_field_multiplications_per_iteration=*/1);
+        }
+        return s_vec;
+    }
+
+    /**
+     * @brief Reduce an IPA opening claim to an accumulator, doing all of the verification except the MSM against the
+     * SRS
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claim The claim being opened
+     * @param transcript Verifier transcript containing L_vec, R_vec and a_zero
+     */
+    static VerifierAccumulator reduce_verify(const std::shared_ptr<VK>& vk,
+                                             const OpeningClaim<Curve>& opening_claim,
+                                             const std::shared_ptr<NativeTranscript>& transcript)
     {
         auto poly_degree = static_cast<uint32_t>(transcript->template receive_from_prover<typename Curve::BaseField>(
             "IPA:poly_degree")); // note this is base field because this is a uint32_t, which should map to a bb::fr,
@@ -232,61 +315,99 @@ template <typename Curve> class IPA {
                                    opening_claim.opening_pair.challenge.pow(exponent));
         }
 
-        // Compute G_zero
-        // First construct s_vec
-        std::vector<Fr> s_vec(poly_degree);
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/857): This code is not efficient as its O(nlogn).
-        // This can be optimized to be linear by computing a tree of products. Its very readable, so we're
-        // leaving it unoptimized for now.
-        run_loop_in_parallel_if_effective(
-            poly_degree,
-            [&s_vec, &round_challenges_inv, log_poly_degree](size_t start, size_t end) {
-                for (size_t i = start; i < end; i++) {
-                    Fr s_vec_scalar = Fr::one();
-                    for (size_t j = (log_poly_degree - 1); j != size_t(-1); j--) {
-                        auto bit = (i >> j) & 1;
-                        bool b = static_cast<bool>(bit);
-                        if (b) {
-                            s_vec_scalar *= round_challenges_inv[log_poly_degree - 1 - j];
-                        }
-                    }
-                    s_vec[i] = s_vec_scalar;
-                }
-            },
-            /*finite_field_additions_per_iteration=*/0,
-            /*finite_field_multiplications_per_iteration=*/log_poly_degree);
+        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
 
-        auto* srs_elements = vk->srs->get_monomial_points();
+        return { std::move(round_challenges_inv), a_zero, C_zero - aux_generator * (a_zero * b_zero) };
+    }
 
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_degree);
+    /**
+     * @brief Check a batch of accumulators with a single MSM against the SRS
+     *
+     * @details With random weights r_i, the accumulators are valid (except with negligible probability) iff
+     * < ∑_i r_i⋅a_zero_i⋅s_vec_i, G_vec > == ∑_i r_i⋅commitment_i. The MSM is as large as the largest opening, so the
+     * cost of this step is amortized over the batch.
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param accumulators Accumulators produced by reduce_verify
+     *
+     * @return true/false depending on whether all the accumulators are valid
+     */
+    static bool verify_accumulators(const std::shared_ptr<VK>& vk, std::span<const VerifierAccumulator> accumulators)
+    {
+        if (accumulators.empty()) {
+            return true;
+        }
+        size_t max_poly_degree = 0;
+        for (const auto& accumulator : accumulators) {
+            max_poly_degree = std::max(max_poly_degree, 1UL << accumulator.round_challenges_inv.size());
+        }
 
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        run_loop_in_parallel_if_effective(
-            poly_degree,
-            [&G_vec_local, srs_elements](size_t start, size_t end) {
-                for (size_t i = start * 2; i < end * 2; i += 2) {
-                    G_vec_local[i >> 1] = srs_elements[i];
-                }
-            },
-            /*finite_field_additions_per_iteration=*/0,
-            /*finite_field_multiplications_per_iteration=*/0,
-            /*finite_field_inversions_per_iteration=*/0,
-            /*group_element_additions_per_iteration=*/0,
-            /*group_element_doublings_per_iteration=*/0,
-            /*scalar_multiplications_per_iteration=*/0,
-            /*sequential_copy_ops_per_iteration=*/1);
+        std::vector<Fr> msm_scalars(max_poly_degree, Fr::zero());
+        GroupElement expected = GroupElement::infinity();
+        for (size_t i = 0; i < accumulators.size(); i++) {
+            const auto& accumulator = accumulators[i];
+            // The first weight can be one without loss of soundness
+            const Fr weight = (i == 0) ? Fr::one() : Fr::random_element();
+            const std::vector<Fr> s_vec = compute_s_vec(accumulator.round_challenges_inv, weight * accumulator.a_zero);
+            run_loop_in_parallel_if_effective(
+                s_vec.size(),
+                [&msm_scalars, &s_vec](size_t start, size_t end) {
+                    for (size_t j = start; j < end; j++) {
+                        msm_scalars[j] += s_vec[j];
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/1);
+            expected += accumulator.commitment * weight;
+        }
 
-        auto G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_degree, vk->pippenger_runtime_state);
+        // The SRS stored in the verification key already is a pippenger point table, so there is no need to extract
+        // the G_vec and recompute the table
+        GroupElement G_sum = bb::scalar_multiplication::pippenger<Curve>(&msm_scalars[0],
+                                                                        vk->srs->get_monomial_points(),
+                                                                        max_poly_degree,
+                                                                        vk->pippenger_runtime_state,
+                                                                        /*handle_edge_cases=*/false);
 
-        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+        return (G_sum.normalize() == expected.normalize());
+    }
 
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+    /**
+     * @brief Verify the correctness of a Proof
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param proof The proof containg L_vec, R_vec and a_zero
+     * @param pub_input Data required to verify the proof
+     *
+     * @return true/false depending on if the proof verifies
+     */
+    static bool verify(const std::shared_ptr<VK>& vk,
+                       const OpeningClaim<Curve>& opening_claim,
+                       const std::shared_ptr<NativeTranscript>& transcript)
+    {
+        const VerifierAccumulator accumulator = reduce_verify(vk, opening_claim, transcript);
+        return verify_accumulators(vk, { &accumulator, 1 });
+    }
 
-        return (C_zero.normalize() == right_hand_side.normalize());
+    /**
+     * @brief Verify a batch of proofs, sharing the MSM against the SRS between all of them
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claims The claims being opened
+     * @param transcripts Verifier transcripts of the proofs, one per claim
+     *
+     * @return true/false depending on whether all the proofs verify
+     */
+    static bool batch_verify(const std::shared_ptr<VK>& vk,
+                             std::span<const OpeningClaim<Curve>> opening_claims,
+                             std::span<const std::shared_ptr<NativeTranscript>> transcripts)
+    {
+        ASSERT(opening_claims.size() == transcripts.size());
+        std::vector<VerifierAccumulator> accumulators;
+        accumulators.reserve(opening_claims.size());
+        for (size_t i = 0; i < opening_claims.size(); i++) {
+            accumulators.emplace_back(reduce_verify(vk, opening_claims[i], transcripts[i]));
+        }
+        return verify_accumulators(vk, accumulators);
     }
 };
 
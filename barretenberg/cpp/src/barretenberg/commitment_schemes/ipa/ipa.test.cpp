@@ -84,6 +84,65 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, BatchVerify)
+{
+    using IPA = IPA<Curve>;
+    // openings of different sizes share the MSM against the SRS
+    const std::vector<size_t> sizes = { 128, 32, 128, 4 };
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+    for (const size_t n : sizes) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        auto commitment = this->commit(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, commitment });
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+        verifier_transcripts.push_back(std::make_shared<NativeTranscript>(prover_transcript->proof_data));
+    }
+    const auto fresh_transcripts = [&verifier_transcripts]() {
+        std::vector<std::shared_ptr<NativeTranscript>> transcripts;
+        for (const auto& transcript : verifier_transcripts) {
+            transcripts.push_back(std::make_shared<NativeTranscript>(transcript->proof_data));
+        }
+        return transcripts;
+    };
+
+    EXPECT_TRUE(IPA::batch_verify(this->vk(), opening_claims, fresh_transcripts()));
+
+    // A single bad claim makes the whole batch fail
+    opening_claims[2].opening_pair.evaluation += Fr::one();
+    EXPECT_FALSE(IPA::batch_verify(this->vk(), opening_claims, fresh_transcripts()));
+}
+
+TEST_F(IPATest, DeferredAccumulatorVerification)
+{
+    using IPA = IPA<Curve>;
+    constexpr size_t num_openings = 3;
+    constexpr size_t n = 64;
+    std::vector<IPA::VerifierAccumulator> accumulators;
+    for (size_t i = 0; i < num_openings; i++) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        auto commitment = this->commit(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        const OpeningClaim<Curve> opening_claim{ opening_pair, commitment };
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+        auto verifier_transcript = std::make_shared<NativeTranscript>(prover_transcript->proof_data);
+        accumulators.emplace_back(IPA::reduce_verify(this->vk(), opening_claim, verifier_transcript));
+        EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
+    }
+
+    EXPECT_TRUE(IPA::verify_accumulators(this->vk(), accumulators));
+
+    accumulators[1].a_zero += Fr::one();
+    EXPECT_FALSE(IPA::verify_accumulators(this->vk(), accumulators));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
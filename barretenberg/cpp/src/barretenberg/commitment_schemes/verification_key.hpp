@@ -15,8 +15,10 @@
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <array>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
 
 namespace bb {
@@ -30,6 +32,7 @@ template <class Curve> class VerifierCommitmentKey;
  */
 template <> class VerifierCommitmentKey<curve::BN254> {
     using Curve = curve::BN254;
+    using Fr = typename Curve::ScalarField;
     using GroupElement = typename Curve::Element;
     using Commitment = typename Curve::AffineElement;
 
@@ -58,6 +61,66 @@ template <> class VerifierCommitmentKey<curve::BN254> {
 
         return (result == Curve::TargetField::one());
     }
+
+    /**
+     * @brief Combines a batch of pairing equations e(P₀ⁱ,[1]₂)e(P₁ⁱ,[x]₂) ≡ [1]ₜ into the single equation
+     * e(∑rᵢP₀ⁱ,[1]₂)e(∑rᵢP₁ⁱ,[x]₂) ≡ [1]ₜ with random weights rᵢ (r₀ = 1)
+     * @details A batch containing a failing equation yields a passing combined equation with negligible probability.
+     * Static so that verifiers holding their own G2 lines (e.g. Plonk) can share it.
+     *
+     * @param pairing_points pairs (P₀ⁱ, P₁ⁱ)
+     * @return (∑rᵢP₀ⁱ, ∑rᵢP₁ⁱ)
+     */
+    static std::array<GroupElement, 2> batch_pairing_points(std::span<const std::array<Commitment, 2>> pairing_points)
+    {
+        if (pairing_points.empty()) {
+            return { GroupElement::infinity(), GroupElement::infinity() };
+        }
+        const size_t num_pairs = pairing_points.size();
+        std::vector<Fr> weights(num_pairs);
+        weights[0] = Fr::one();
+        for (size_t i = 1; i < num_pairs; ++i) {
+            weights[i] = Fr::random_element();
+        }
+
+        // Compute ∑rᵢPⱼⁱ, skipping points at infinity since they do not contribute to the pairing
+        const auto batch_mul = [&](size_t j) {
+            std::vector<Fr> scalars;
+            std::vector<Commitment> points;
+            for (size_t i = 0; i < num_pairs; ++i) {
+                if (!pairing_points[i][j].is_point_at_infinity()) {
+                    scalars.emplace_back(weights[i]);
+                    points.emplace_back(pairing_points[i][j]);
+                }
+            }
+            const size_t num_points = points.size();
+            if (num_points == 0) {
+                return GroupElement::infinity();
+            }
+            points.resize(num_points * 2);
+            scalar_multiplication::generate_pippenger_point_table<Curve>(&points[0], &points[0], num_points);
+            scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+            return scalar_multiplication::pippenger<Curve>(&scalars[0], &points[0], num_points, state);
+        };
+
+        return { batch_mul(0), batch_mul(1) };
+    }
+
+    /**
+     * @brief verifies a batch of pairing equations e(P₀ⁱ,[1]₂)e(P₁ⁱ,[x]₂) ≡ [1]ₜ with a single pairing
+     * @details The equations are combined by batch_pairing_points, so the check costs two Miller loops and one final
+     * exponentiation irrespective of the size of the batch.
+     *
+     * @param pairing_points pairs (P₀ⁱ, P₁ⁱ)
+     */
+    bool batch_pairing_check(std::span<const std::array<Commitment, 2>> pairing_points)
+    {
+        if (pairing_points.empty()) {
+            return true;
+        }
+        const auto [P_0, P_1] = batch_pairing_points(pairing_points);
+        return pairing_check(P_0, P_1);
+    }
 };
 
 /**
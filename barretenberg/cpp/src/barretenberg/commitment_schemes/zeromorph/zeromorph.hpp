@@ -2,6 +2,7 @@
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/transcript/transcript.hpp"
@@ -69,44 +70,50 @@ template <typename Curve> class ZeroMorphProver_ {
 
         // Define the vector of quotients q_k, k = 0, ..., log_N-1
         std::vector<Polynomial> quotients;
+        std::vector<std::span<FF>> quotient_spans;
         for (size_t k = 0; k < log_N; ++k) {
             size_t size = 1 << k;
             quotients.emplace_back(Polynomial(size)); // degree 2^k - 1
+            quotient_spans.emplace_back(quotients.back());
         }
 
-        // Compute the coefficients of q_{n-1}
-        size_t size_q = 1 << (log_N - 1);
-        Polynomial q{ size_q };
-        for (size_t l = 0; l < size_q; ++l) {
-            q[l] = polynomial[size_q + l] - polynomial[l];
-        }
-
-        quotients[log_N - 1] = q.share();
-
-        std::vector<FF> f_k;
-        f_k.resize(size_q);
-
-        std::vector<FF> g(polynomial.data().get(), polynomial.data().get() + size_q);
-
-        // Compute q_k in reverse order from k= n-2, i.e. q_{n-2}, ..., q_0
-        for (size_t k = 1; k < log_N; ++k) {
-            // Compute f_k
-            for (size_t l = 0; l < size_q; ++l) {
-                f_k[l] = g[l] + u_challenge[log_N - k] * q[l];
-            }
+        compute_multilinear_quotients_in_place(polynomial, u_challenge, quotient_spans);
 
-            size_q = size_q / 2;
-            q = Polynomial{ size_q };
-
-            for (size_t l = 0; l < size_q; ++l) {
-                q[l] = f_k[size_q + l] - f_k[l];
-            }
+        return quotients;
+    }
 
-            quotients[log_N - k - 1] = q.share();
-            g = f_k;
+    /**
+     * @brief Compute the multivariate quotients q_k as in compute_multilinear_quotients, but without allocating
+     * @details The update f[l] <- f[l] + u_k * q_k[l] only touches the half of f that is still needed, so f is updated
+     * in place and q_k is written directly into the provided output.
+     *
+     * @param polynomial Multilinear polynomial f(X_0, ..., X_{d-1}), overwritten
+     * @param u_challenge Multivariate challenge u = (u_0, ..., u_{d-1})
+     * @param quotients Output quotients q_k, of size 2^k
+     */
+    static void compute_multilinear_quotients_in_place(std::span<FF> polynomial,
+                                                       std::span<const FF> u_challenge,
+                                                       std::span<const std::span<FF>> quotients)
+    {
+        const size_t log_N = u_challenge.size();
+        ASSERT(quotients.size() == log_N);
+
+        // Compute q_k in reverse order from k = n-1, i.e. q_{n-1}, ..., q_0
+        for (size_t k = log_N - 1; k < log_N; --k) {
+            const size_t size_q = 1UL << k;
+            const std::span<FF> quotient = quotients[k];
+            const FF u_k = u_challenge[k];
+            run_loop_in_parallel_if_effective(
+                size_q,
+                [&polynomial, quotient, u_k, size_q](size_t start, size_t end) {
+                    for (size_t l = start; l < end; ++l) {
+                        quotient[l] = polynomial[size_q + l] - polynomial[l];
+                        polynomial[l] += u_k * quotient[l];
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/2,
+                /*finite_field_multiplications_per_iteration=*/1);
         }
-
-        return quotients;
     }
 
     /**
@@ -127,23 +134,42 @@ template <typename Curve> class ZeroMorphProver_ {
     {
         // Batched lifted degree quotient polynomial
         auto result = Polynomial(N);
+        compute_batched_lifted_degree_quotient(
+            std::vector<std::span<FF>>(quotients.begin(), quotients.end()), y_challenge, result);
+        return result;
+    }
+
+    /**
+     * @brief Construct the batched, lifted-degree univariate quotient \hat{q} into the provided (arbitrary) buffer
+     *
+     * @param quotients q_k, interpreted as univariates; deg(q_k) = 2^k - 1
+     * @param result Output \hat{q}, of size N
+     */
+    static void compute_batched_lifted_degree_quotient(std::span<const std::span<FF>> quotients,
+                                                       FF y_challenge,
+                                                       std::span<FF> result)
+    {
+        const size_t N = result.size();
+        std::fill(result.begin(), result.end(), FF(0));
 
         // Compute \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k
-        size_t k = 0;
         auto scalar = FF(1); // y^k
-        for (auto& quotient : quotients) {
+        for (size_t k = 0; k < quotients.size(); ++k) {
             // Rather than explicitly computing the shifts of q_k by N - d_k - 1 (i.e. multiplying q_k by X^{N - d_k -
             // 1}) then accumulating them, we simply accumulate y^k*q_k into \hat{q} at the index offset N - d_k - 1
-            auto deg_k = static_cast<size_t>((1 << k) - 1);
-            size_t offset = N - deg_k - 1;
-            for (size_t idx = 0; idx < deg_k + 1; ++idx) {
-                result[offset + idx] += scalar * quotient[idx];
-            }
+            const std::span<const FF> quotient = quotients[k];
+            const size_t offset = N - quotient.size();
+            run_loop_in_parallel_if_effective(
+                quotient.size(),
+                [&result, quotient, scalar, offset](size_t start, size_t end) {
+                    for (size_t idx = start; idx < end; ++idx) {
+                        result[offset + idx] += scalar * quotient[idx];
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/1,
+                /*finite_field_multiplications_per_iteration=*/1);
             scalar *= y_challenge; // update batching scalar y^k
-            k++;
         }
-
-        return result;
     }
 
     /**
@@ -162,25 +188,36 @@ template <typename Curve> class ZeroMorphProver_ {
                                                                           std::vector<Polynomial>& quotients,
                                                                           FF y_challenge,
                                                                           FF x_challenge)
+    {
+        auto result = batched_quotient;
+        compute_partially_evaluated_degree_check_polynomial_in_place(
+            result, std::vector<std::span<FF>>(quotients.begin(), quotients.end()), y_challenge, x_challenge);
+        return result;
+    }
+
+    /**
+     * @brief Compute the partially evaluated degree check polynomial \zeta_x, overwriting \hat{q}
+     *
+     * @param batched_quotient \hat{q} on input, \zeta_x on output
+     */
+    static void compute_partially_evaluated_degree_check_polynomial_in_place(std::span<FF> batched_quotient,
+                                                                             std::span<const std::span<FF>> quotients,
+                                                                             FF y_challenge,
+                                                                             FF x_challenge)
     {
         size_t N = batched_quotient.size();
         size_t log_N = quotients.size();
 
-        // Initialize partially evaluated degree check polynomial \zeta_x to \hat{q}
-        auto result = batched_quotient;
-
         auto y_power = FF(1); // y^k
         for (size_t k = 0; k < log_N; ++k) {
             // Accumulate y^k * x^{N - d_k - 1} * q_k into \hat{q}
             auto deg_k = static_cast<size_t>((1 << k) - 1);
             auto x_power = x_challenge.pow(N - deg_k - 1); // x^{N - d_k - 1}
 
-            result.add_scaled(quotients[k], -y_power * x_power);
+            add_scaled(batched_quotient, quotients[k], -y_power * x_power);
 
             y_power *= y_challenge; // update batching scalar y^k
         }
-
-        return result;
     }
 
     /**
@@ -211,13 +248,39 @@ template <typename Curve> class ZeroMorphProver_ {
         std::span<const FF> u_challenge,
         FF x_challenge,
         std::vector<Polynomial> concatenation_groups_batched = {})
+    {
+        auto result = g_batched;
+        compute_partially_evaluated_zeromorph_identity_polynomial_in_place(
+            result,
+            f_batched,
+            std::vector<std::span<FF>>(quotients.begin(), quotients.end()),
+            v_evaluation,
+            u_challenge,
+            x_challenge,
+            concatenation_groups_batched);
+        return result;
+    }
+
+    /**
+     * @brief Compute the partially evaluated zeromorph identity polynomial Z_x, overwriting g_batched
+     *
+     * @param g_batched g_batched on input, Z_x on output
+     */
+    static void compute_partially_evaluated_zeromorph_identity_polynomial_in_place(
+        std::span<FF> g_batched,
+        std::span<const FF> f_batched,
+        std::span<const std::span<FF>> quotients,
+        FF v_evaluation,
+        std::span<const FF> u_challenge,
+        FF x_challenge,
+        std::span<const Polynomial> concatenation_groups_batched = {})
     {
         size_t N = f_batched.size();
         size_t log_N = quotients.size();
 
         // Initialize Z_x with x * \sum_{i=0}^{m-1} f_i + \sum_{i=0}^{l-1} g_i
-        auto result = g_batched;
-        result.add_scaled(f_batched, x_challenge);
+        std::span<FF> result = g_batched;
+        add_scaled(result, f_batched, x_challenge);
 
         // Compute Z_x -= v * x * \Phi_n(x)
         auto phi_numerator = x_challenge.pow(N) - 1; // x^N - 1
@@ -241,7 +304,7 @@ template <typename Curve> class ZeroMorphProver_ {
             scalar *= x_challenge;
             scalar *= FF(-1);
 
-            result.add_scaled(quotients[k], scalar);
+            add_scaled(result, quotients[k], scalar);
         }
 
         // If necessary, add to Z_x the contribution related to concatenated polynomials:
@@ -254,12 +317,10 @@ template <typename Curve> class ZeroMorphProver_ {
                 x_challenge.pow(MINICIRCUIT_N); // power of x used to shift polynomials to the right
             auto running_shift = x_challenge;
             for (size_t i = 0; i < concatenation_groups_batched.size(); i++) {
-                result.add_scaled(concatenation_groups_batched[i], running_shift);
+                add_scaled(result, concatenation_groups_batched[i], running_shift);
                 running_shift *= x_to_minicircuit_N;
             }
         }
-
-        return result;
     }
 
     /**
@@ -268,29 +329,26 @@ template <typename Curve> class ZeroMorphProver_ {
      *
      *  pi = (q_\zeta + z*q_Z) X^{N_{max}-(N-1)}, with q_\zeta = \zeta_x/(X-x), q_Z = Z_x/(X-x)
      *
+     * Both \zeta_x and Z_x vanish at x and division by (X-x) is linear, so we batch first and then factor out (X-x)
+     * once: q_\zeta + z*q_Z = (\zeta_x + z*Z_x)/(X-x).
+     *
+     * @param zeta_x \zeta_x on input, pi on output
      * @param Z_x
-     * @param zeta_x
      * @param x_challenge
      * @param z_challenge
-     * @param N_max
-     * @return Polynomial
      */
-    static Polynomial compute_batched_evaluation_and_degree_check_quotient(Polynomial& zeta_x,
-                                                                           Polynomial& Z_x,
-                                                                           FF x_challenge,
-                                                                           FF z_challenge)
+    static void compute_batched_evaluation_and_degree_check_quotient(std::span<FF> zeta_x,
+                                                                     std::span<const FF> Z_x,
+                                                                     FF x_challenge,
+                                                                     FF z_challenge)
     {
         // We cannot commit to polynomials with size > N_max
         size_t N = zeta_x.size();
         ASSERT(N <= N_max);
 
-        // Compute q_{\zeta} and q_Z in place
-        zeta_x.factor_roots(x_challenge);
-        Z_x.factor_roots(x_challenge);
-
-        // Compute batched quotient q_{\zeta} + z*q_Z
-        auto batched_quotient = zeta_x;
-        batched_quotient.add_scaled(Z_x, z_challenge);
+        // Compute batched quotient q_{\zeta} + z*q_Z in place
+        add_scaled(zeta_x, Z_x, z_challenge);
+        polynomial_arithmetic::factor_roots(zeta_x, x_challenge);
 
         // TODO(#742): To complete the degree check, we need to commit to (q_{\zeta} + z*q_Z)*X^{N_max - N - 1}.
         // Verification then requires a pairing check similar to the standard KZG check but with [1]_2 replaced by
@@ -301,14 +359,68 @@ template <typename Curve> class ZeroMorphProver_ {
         // update the pairing check accordingly. Note: When this is implemented properly, it doesnt make sense to store
         // the (massive) shifted polynomial of size N_max. Ideally would only store the unshifted version and just
         // compute the shifted commitment directly via a new method.
-        auto batched_shifted_quotient = batched_quotient;
+    }
 
-        return batched_shifted_quotient;
+    /**
+     * @brief Batch the unshifted, to-be-shifted and concatenated polynomials and form the full batched polynomial
+     * f = f_batched + g_batched.shifted() + concatenated_batched, all in a single pass over the coefficients
+     * @details The shift makes f[end - 1] depend on g_batched[end], which belongs to the range of the next thread, so
+     * that one coefficient is recomputed from the inputs.
+     *
+     * @param batching_scalars Scalars of the f_i, followed by those of the g_i and of the concatenated polynomials
+     * @param f_batched Output, zero on input
+     * @param g_batched Output, zero on input
+     * @param f_polynomial Output, arbitrary on input
+     */
+    static void batch_polynomials(RefSpan<Polynomial> f_polynomials,
+                                  RefSpan<Polynomial> g_polynomials,
+                                  RefSpan<Polynomial> concatenated_polynomials,
+                                  std::span<const FF> batching_scalars,
+                                  std::span<FF> f_batched,
+                                  std::span<FF> g_batched,
+                                  std::span<FF> f_polynomial)
+    {
+        const size_t N = f_polynomial.size();
+        const size_t num_f_polynomials = f_polynomials.size();
+        const size_t num_g_polynomials = g_polynomials.size();
+        const size_t num_polynomials = num_f_polynomials + num_g_polynomials + concatenated_polynomials.size();
+        run_loop_in_parallel_if_effective(
+            N,
+            [&](size_t start, size_t end) {
+                const auto batch = [&](RefSpan<Polynomial> polynomials, size_t scalar_offset, std::span<FF> result) {
+                    for (size_t i = 0; i < polynomials.size(); ++i) {
+                        const Polynomial& polynomial = polynomials[i];
+                        const FF& scalar = batching_scalars[scalar_offset + i];
+                        const size_t polynomial_end = std::min(end, polynomial.size());
+                        for (size_t j = start; j < polynomial_end; ++j) {
+                            result[j] += scalar * polynomial[j];
+                        }
+                    }
+                };
+                batch(f_polynomials, 0, f_batched);
+                batch(g_polynomials, num_f_polynomials, g_batched);
+
+                FF g_batched_next{ 0 };
+                for (size_t i = 0; i < num_g_polynomials; ++i) {
+                    if (end < g_polynomials[i].size()) {
+                        g_batched_next += batching_scalars[num_f_polynomials + i] * g_polynomials[i][end];
+                    }
+                }
+                for (size_t j = start; j < end; ++j) {
+                    f_polynomial[j] = f_batched[j] + ((j + 1 < end) ? g_batched[j + 1] : g_batched_next);
+                }
+                batch(concatenated_polynomials, num_f_polynomials + num_g_polynomials, f_polynomial);
+            },
+            /*finite_field_additions_per_iteration=*/num_polynomials + 1,
+            /*finite_field_multiplications_per_iteration=*/num_polynomials);
     }
 
     /**
      * @brief Prove a set of multilinear evaluation claims for unshifted polynomials f_i and to-be-shifted
      * polynomials g_i
+     * @details Apart from the concatenation groups, the prover works with four buffers of size N: f_batched, g_batched,
+     * the packed quotients q_k and f, which is overwritten by the quotient computation and then reused for \hat{q},
+     * \zeta_x and finally pi. Likewise g_batched is overwritten by Z_x.
      *
      * @param f_polynomials Unshifted polynomials
      * @param g_polynomials To-be-shifted polynomials (of which the shifts h_i were evaluated by sumcheck)
@@ -336,72 +448,77 @@ template <typename Curve> class ZeroMorphProver_ {
         size_t log_N = u_challenge.size();
         size_t N = 1 << log_N;
 
-        // Compute batching of unshifted polynomials f_i and to-be-shifted polynomials g_i:
-        // f_batched = sum_{i=0}^{m-1}\rho^i*f_i and g_batched = sum_{i=0}^{l-1}\rho^{m+i}*g_i,
-        // and also batched evaluation
+        // Compute the batched evaluation
         // v = sum_{i=0}^{m-1}\rho^i*f_i(u) + sum_{i=0}^{l-1}\rho^{m+i}*h_i(u).
         // Note: g_batched is formed from the to-be-shifted polynomials, but the batched evaluation incorporates the
         // evaluations produced by sumcheck of h_i = g_i_shifted.
+        const size_t num_polynomials = f_polynomials.size() + g_polynomials.size() + concatenated_polynomials.size();
+        const std::vector<FF> batching_scalars = powers_of_challenge(rho, num_polynomials);
         FF batched_evaluation{ 0 };
-        Polynomial f_batched(N); // batched unshifted polynomials
-        FF batching_scalar{ 1 };
-        for (auto [f_poly, f_eval] : zip_view(f_polynomials, f_evaluations)) {
-            f_batched.add_scaled(f_poly, batching_scalar);
-            batched_evaluation += batching_scalar * f_eval;
-            batching_scalar *= rho;
+        size_t scalar_idx = 0;
+        for (auto& f_eval : f_evaluations) {
+            batched_evaluation += batching_scalars[scalar_idx++] * f_eval;
+        }
+        for (auto& g_shift_eval : g_shift_evaluations) {
+            batched_evaluation += batching_scalars[scalar_idx++] * g_shift_eval;
+        }
+        const size_t concatenated_scalar_offset = scalar_idx;
+        for (auto& concatenated_eval : concatenated_evaluations) {
+            batched_evaluation += batching_scalars[scalar_idx++] * concatenated_eval;
         }
 
-        Polynomial g_batched{ N }; // batched to-be-shifted polynomials
-        for (auto [g_poly, g_shift_eval] : zip_view(g_polynomials, g_shift_evaluations)) {
-            g_batched.add_scaled(g_poly, batching_scalar);
-            batched_evaluation += batching_scalar * g_shift_eval;
-            batching_scalar *= rho;
-        };
-
+        // construct concatention_groups_batched
         size_t num_groups = concatenation_groups.size();
         size_t num_chunks_per_group = concatenation_groups.empty() ? 0 : concatenation_groups[0].size();
-        // Concatenated polynomials
-        Polynomial concatenated_batched(N);
-
-        // construct concatention_groups_batched
         std::vector<Polynomial> concatenation_groups_batched;
         for (size_t i = 0; i < num_chunks_per_group; ++i) {
             concatenation_groups_batched.push_back(Polynomial(N));
         }
         // for each group
         for (size_t i = 0; i < num_groups; ++i) {
-            concatenated_batched.add_scaled(concatenated_polynomials[i], batching_scalar);
             // for each element in a group
             for (size_t j = 0; j < num_chunks_per_group; ++j) {
-                concatenation_groups_batched[j].add_scaled(concatenation_groups[i][j], batching_scalar);
+                concatenation_groups_batched[j].add_scaled(concatenation_groups[i][j],
+                                                           batching_scalars[concatenated_scalar_offset + i]);
             }
-            batched_evaluation += batching_scalar * concatenated_evaluations[i];
-            batching_scalar *= rho;
         }
 
-        // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched. This is the
-        // polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
-        Polynomial f_polynomial = f_batched;
-        f_polynomial += g_batched.shifted();
-        f_polynomial += concatenated_batched;
-
-        // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1})
-        auto quotients = compute_multilinear_quotients(f_polynomial, u_challenge);
+        // Compute batching of unshifted polynomials f_i and to-be-shifted polynomials g_i:
+        // f_batched = sum_{i=0}^{m-1}\rho^i*f_i and g_batched = sum_{i=0}^{l-1}\rho^{m+i}*g_i, and the full batched
+        // polynomial f = f_batched + g_batched.shifted() + concatenated_batched = f_batched + h_batched +
+        // concatenated_batched. This is the polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
+        Polynomial f_batched(N);
+        Polynomial g_batched(N);
+        Polynomial f_polynomial(N, DontZeroMemory::FLAG);
+        batch_polynomials(f_polynomials,
+                          g_polynomials,
+                          concatenated_polynomials,
+                          batching_scalars,
+                          f_batched,
+                          g_batched,
+                          f_polynomial);
+
+        // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1}). They are packed into a single buffer, q_k
+        // of size 2^k starting at offset 2^k - 1.
+        Polynomial quotient_buffer(N, DontZeroMemory::FLAG);
+        std::vector<std::span<FF>> quotients;
+        for (size_t k = 0; k < log_N; ++k) {
+            quotients.emplace_back(std::span<FF>(quotient_buffer).subspan((1UL << k) - 1, 1UL << k));
+        }
+        compute_multilinear_quotients_in_place(f_polynomial, u_challenge, quotients);
 
         // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1
-        std::vector<Commitment> q_k_commitments;
-        q_k_commitments.reserve(log_N);
         for (size_t idx = 0; idx < log_N; ++idx) {
-            q_k_commitments[idx] = commitment_key->commit(quotients[idx]);
             std::string label = "ZM:C_q_" + std::to_string(idx);
-            transcript->send_to_verifier(label, q_k_commitments[idx]);
+            transcript->send_to_verifier(label, commitment_key->commit(quotients[idx]));
         }
 
         // Get challenge y
         FF y_challenge = transcript->template get_challenge<FF>("ZM:y");
 
-        // Compute the batched, lifted-degree quotient \hat{q}
-        auto batched_quotient = compute_batched_lifted_degree_quotient(quotients, y_challenge, N);
+        // Compute the batched, lifted-degree quotient \hat{q}, reusing the memory of f
+        Polynomial& batched_quotient = f_polynomial;
+        compute_batched_lifted_degree_quotient(quotients, y_challenge, batched_quotient);
 
         // Compute and send the commitment C_q = [\hat{q}]
         auto q_commitment = commitment_key->commit(batched_quotient);
@@ -410,27 +527,46 @@ template <typename Curve> class ZeroMorphProver_ {
         // Get challenges x and z
         auto [x_challenge, z_challenge] = transcript->template get_challenges<FF>("ZM:x", "ZM:z");
 
-        // Compute degree check polynomial \zeta partially evaluated at x
-        auto zeta_x =
-            compute_partially_evaluated_degree_check_polynomial(batched_quotient, quotients, y_challenge, x_challenge);
+        // Compute degree check polynomial \zeta partially evaluated at x, overwriting \hat{q}
+        Polynomial& zeta_x = batched_quotient;
+        compute_partially_evaluated_degree_check_polynomial_in_place(zeta_x, quotients, y_challenge, x_challenge);
 
-        // Compute ZeroMorph identity polynomial Z partially evaluated at x
-        auto Z_x = compute_partially_evaluated_zeromorph_identity_polynomial(f_batched,
-                                                                             g_batched,
-                                                                             quotients,
-                                                                             batched_evaluation,
-                                                                             u_challenge,
-                                                                             x_challenge,
-                                                                             concatenation_groups_batched);
+        // Compute ZeroMorph identity polynomial Z partially evaluated at x, overwriting g_batched
+        Polynomial& Z_x = g_batched;
+        compute_partially_evaluated_zeromorph_identity_polynomial_in_place(Z_x,
+                                                                           f_batched,
+                                                                           quotients,
+                                                                           batched_evaluation,
+                                                                           u_challenge,
+                                                                           x_challenge,
+                                                                           concatenation_groups_batched);
 
-        // Compute batched degree-check and ZM-identity quotient polynomial pi
-        auto pi_polynomial =
-            compute_batched_evaluation_and_degree_check_quotient(zeta_x, Z_x, x_challenge, z_challenge);
+        // Compute batched degree-check and ZM-identity quotient polynomial pi, overwriting \zeta_x
+        Polynomial& pi_polynomial = zeta_x;
+        compute_batched_evaluation_and_degree_check_quotient(pi_polynomial, Z_x, x_challenge, z_challenge);
 
         // Compute and send proof commitment pi
         auto pi_commitment = commitment_key->commit(pi_polynomial);
         transcript->send_to_verifier("ZM:PI", pi_commitment);
     }
+
+  private:
+    /**
+     * @brief result += scaling_factor * other, where other may be shorter than result
+     */
+    static void add_scaled(std::span<FF> result, std::span<const FF> other, const FF& scaling_factor)
+    {
+        ASSERT(other.size() <= result.size());
+        run_loop_in_parallel_if_effective(
+            other.size(),
+            [&result, other, scaling_factor](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i) {
+                    result[i] += scaling_factor * other[i];
+                }
+            },
+            /*finite_field_additions_per_iteration=*/1,
+            /*finite_field_multiplications_per_iteration=*/1);
+    }
 };
 
 /**
@@ -122,7 +122,13 @@ namespace bb {
  */
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func)
 {
+#ifdef __wasm__
+    // The workers persist for the lifetime of the module and are never joined, as joining threads can hang under
+    // wasi-sdk pthreads. The pool is deliberately leaked so no destructor runs at exit.
+    static ThreadPool& pool = *new ThreadPool(get_num_cpus() - 1);
+#else
     static ThreadPool pool(get_num_cpus() - 1);
+#endif
 
     // info("starting job with iterations: ", num_iterations);
     pool.start_tasks(num_iterations, func);
@@ -8,9 +8,14 @@ namespace bb {
  */
 void parallel_for_spawning(size_t num_iterations, const std::function<void(size_t)>& func)
 {
+    if (num_iterations == 0) {
+        return;
+    }
     std::atomic<size_t> current_iteration(0);
 
     auto worker = [&](size_t) {
+        // Nested parallel loops on a worker run serially rather than oversubscribing the machine
+        ScopedCpuBudget budget(1);
         // info("entered worker: ", thread_index);
         size_t index = 0;
         while ((index = current_iteration.fetch_add(1, std::memory_order_seq_cst)) < num_iterations) {
@@ -1,5 +1,6 @@
 #include "thread.hpp"
 #include "log.hpp"
+#include <exception>
 
 /**
  * There's a lot to talk about here. To bring threading to WASM, parallel_for was written to replace the OpenMP loops
@@ -34,6 +35,10 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: In threaded WASM builds nothing ever joins a thread. The mutex_pool workers live for the lifetime of the
+ * module, and since concurrently running budgeted tasks would need threads of their own, run_tasks_concurrently runs
+ * its tasks one after another there, each with the whole pool.
  */
 
 namespace bb {
@@ -76,6 +81,22 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
         func(i);
     }
 #else
+#ifndef __wasm__
+    // A thread running under a cpu budget shares the machine with other concurrently running work, so it must not
+    // touch the global pool. Spawn workers bounded by the budget instead.
+    if (detail::thread_cpu_budget != 0) {
+        parallel_for_spawning(num_iterations, func);
+        return;
+    }
+#else
+    // No spawning in WASM (see above). A budget of one cpu can still be honoured by staying on this thread.
+    if (detail::thread_cpu_budget == 1) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+#endif
 #ifndef NO_OMP_MULTITHREADING
     parallel_for_omp(num_iterations, func);
 #else
@@ -88,6 +109,37 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
 #endif
 }
 
+void run_tasks_concurrently(const std::vector<BudgetedTask>& tasks)
+{
+#if defined(NO_MULTITHREADING) || defined(__wasm__)
+    for (const auto& task : tasks) {
+        task.func();
+    }
+#else
+    std::vector<std::exception_ptr> exceptions(tasks.size());
+    std::vector<std::thread> threads;
+    threads.reserve(tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        threads.emplace_back([&tasks, &exceptions, i]() {
+            ScopedCpuBudget budget(tasks[i].num_cpus);
+            try {
+                tasks[i].func();
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+#endif
+}
+
 /**
  * @brief Split a loop into several loops running in parallel
  *
@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <atomic>
 #include <barretenberg/env/hardware_concurrency.hpp>
 #include <barretenberg/numeric/bitop/get_msb.hpp>
@@ -9,15 +10,63 @@
 
 namespace bb {
 
+namespace detail {
+// Maximum number of cpus the current thread may use for parallel work. Zero means no restriction.
+inline thread_local size_t thread_cpu_budget = 0;
+} // namespace detail
+
 inline size_t get_num_cpus()
 {
 #ifdef NO_MULTITHREADING
     return 1;
 #else
-    return env_hardware_concurrency();
+    const size_t num_cpus = env_hardware_concurrency();
+    if (detail::thread_cpu_budget == 0) {
+        return num_cpus;
+    }
+    return std::min(detail::thread_cpu_budget, num_cpus);
 #endif
 }
 
+/**
+ * @brief Restricts the number of cpus used by parallel_for on the current thread for the lifetime of this object
+ * @details Used to give independent proving stages that run concurrently their own share of the machine. While a
+ * budget is set, parallel_for spawns its own workers instead of using the global pool, so that several budgeted
+ * threads can safely run parallel loops at the same time. WASM builds never spawn; there only a budget of one cpu has
+ * an effect, running the loop on the calling thread.
+ */
+class ScopedCpuBudget {
+  public:
+    explicit ScopedCpuBudget(size_t num_cpus)
+        : previous_budget(detail::thread_cpu_budget)
+    {
+        detail::thread_cpu_budget = std::max(num_cpus, static_cast<size_t>(1));
+    }
+    ScopedCpuBudget(const ScopedCpuBudget&) = delete;
+    ScopedCpuBudget(ScopedCpuBudget&&) = delete;
+    ScopedCpuBudget& operator=(const ScopedCpuBudget&) = delete;
+    ScopedCpuBudget& operator=(ScopedCpuBudget&&) = delete;
+    ~ScopedCpuBudget() { detail::thread_cpu_budget = previous_budget; }
+
+  private:
+    size_t previous_budget;
+};
+
+/**
+ * @brief A unit of work for run_tasks_concurrently, along with the number of cpus it is allowed to use
+ */
+struct BudgetedTask {
+    size_t num_cpus;
+    std::function<void()> func;
+};
+
+/**
+ * @brief Run independent tasks concurrently, each on its own thread and restricted to its own cpu budget
+ * @details Returns once all tasks have completed. If a task throws, the first exception is rethrown on the calling
+ * thread after all tasks have been joined. Without multithreading, or in WASM, the tasks are simply run in order.
+ */
+void run_tasks_concurrently(const std::vector<BudgetedTask>& tasks);
+
 // For algorithms that need to be divided amongst power of 2 threads.
 inline size_t get_num_cpus_pow2()
 {
@@ -222,9 +222,61 @@ Builder create_circuit(const AcirFormat& constraint_system, size_t size_hint, Wi
     return builder;
 }
 
+/**
+ * @brief Replace the witness of a circuit previously built from the same constraint system, keeping its gates
+ *
+ * @details The constraint system is executed again over a builder in witness-only mode, which computes every
+ * intermediate variable (and records the witness-dependent lookup reads) without emitting gates. Since variable
+ * creation is deterministic for a fixed constraint system, the fresh variables line up index for index with the frozen
+ * circuit and can be moved into it, so the selectors, wires and copy constraints (and any proving key derived from
+ * them) remain valid. RAM is not supported: the ordering of its sorted access gates depends on the witness.
+ *
+ * @param circuit Circuit built by create_circuit from constraint_system, possibly finalized
+ * @param constraint_system
+ * @param witness
+ * @return false if the witness could not be replayed, in which case circuit is left untouched and must be rebuilt
+ */
+template <typename Builder>
+bool replay_witness(Builder& circuit, AcirFormat const& constraint_system, WitnessVector const& witness)
+{
+    if (!circuit.ram_arrays.empty()) {
+        return false;
+    }
+
+    Builder replay{ 0, witness, constraint_system.public_inputs, constraint_system.varnum, constraint_system.recursive };
+    replay.witness_only = true;
+    build_constraints(replay, constraint_system, /*has_valid_witness_assignments=*/true);
+    if (circuit.circuit_finalized) {
+        replay.finalize_circuit();
+    }
+
+    if (replay.variables.size() != circuit.variables.size() ||
+        replay.lookup_tables.size() != circuit.lookup_tables.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < circuit.lookup_tables.size(); ++i) {
+        if (replay.lookup_tables[i].id != circuit.lookup_tables[i].id ||
+            replay.lookup_tables[i].lookup_gates.size() != circuit.lookup_tables[i].lookup_gates.size()) {
+            return false;
+        }
+    }
+
+    circuit.variables = std::move(replay.variables);
+    for (size_t i = 0; i < circuit.lookup_tables.size(); ++i) {
+        circuit.lookup_tables[i].lookup_gates = std::move(replay.lookup_tables[i].lookup_gates);
+    }
+    if (replay.failed() && !circuit.failed()) {
+        circuit.failure(replay.err());
+    }
+    return true;
+}
+
 template UltraCircuitBuilder create_circuit<UltraCircuitBuilder>(const AcirFormat& constraint_system,
                                                                  size_t size_hint,
                                                                  WitnessVector const& witness);
 template void build_constraints<GoblinUltraCircuitBuilder>(GoblinUltraCircuitBuilder&, AcirFormat const&, bool);
+template bool replay_witness<UltraCircuitBuilder>(UltraCircuitBuilder& circuit,
+                                                  AcirFormat const& constraint_system,
+                                                  WitnessVector const& witness);
 
 } // namespace acir_format
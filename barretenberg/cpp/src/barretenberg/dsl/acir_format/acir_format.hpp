@@ -100,4 +100,7 @@ Builder create_circuit(const AcirFormat& constraint_system, size_t size_hint = 0
 template <typename Builder>
 void build_constraints(Builder& builder, AcirFormat const& constraint_system, bool has_valid_witness_assignments);
 
+template <typename Builder>
+bool replay_witness(Builder& circuit, AcirFormat const& constraint_system, WitnessVector const& witness);
+
 } // namespace acir_format
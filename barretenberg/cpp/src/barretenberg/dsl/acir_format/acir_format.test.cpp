@@ -511,3 +511,78 @@ TEST_F(AcirFormatTests, TestKeccakPermutation)
 
     EXPECT_EQ(verifier.verify_proof(proof), true);
 }
+
+/**
+ * @brief A new witness replayed onto a frozen circuit matches a fresh build and proves against the same proving key
+ */
+TEST_F(AcirFormatTests, ReplayWitness)
+{
+    // x : u32, y : pub u32, z = x ^ y, assert(z != 10) as in TestLogicGateFromNoirCircuit
+    RangeConstraint range_a{ .witness = 0, .num_bits = 32 };
+    RangeConstraint range_b{ .witness = 1, .num_bits = 32 };
+    LogicConstraint logic_constraint{ .a = 0, .b = 1, .result = 2, .num_bits = 32, .is_xor_gate = 1 };
+    poly_triple expr_a{ .a = 2, .b = 3, .c = 0, .q_m = 0, .q_l = 1, .q_r = -1, .q_o = 0, .q_c = -10 };
+    poly_triple expr_b{ .a = 3, .b = 4, .c = 5, .q_m = 1, .q_l = 0, .q_r = 0, .q_o = -1, .q_c = 0 };
+    poly_triple expr_c{ .a = 3, .b = 5, .c = 3, .q_m = 1, .q_l = 0, .q_r = 0, .q_o = -1, .q_c = 0 };
+    poly_triple expr_d{ .a = 5, .b = 0, .c = 0, .q_m = 0, .q_l = -1, .q_r = 0, .q_o = 0, .q_c = 1 };
+
+    AcirFormat constraint_system{ .varnum = 6,
+                                  .recursive = false,
+                                  .public_inputs = { 1 },
+                                  .logic_constraints = { logic_constraint },
+                                  .range_constraints = { range_a, range_b },
+                                  .sha256_constraints = {},
+                                  .sha256_compression = {},
+                                  .schnorr_constraints = {},
+                                  .ecdsa_k1_constraints = {},
+                                  .ecdsa_r1_constraints = {},
+                                  .blake2s_constraints = {},
+                                  .blake3_constraints = {},
+                                  .keccak_constraints = {},
+                                  .keccak_var_constraints = {},
+                                  .keccak_permutations = {},
+                                  .pedersen_constraints = {},
+                                  .pedersen_hash_constraints = {},
+                                  .poseidon2_constraints = {},
+                                  .fixed_base_scalar_mul_constraints = {},
+                                  .ec_add_constraints = {},
+                                  .recursion_constraints = {},
+                                  .bigint_from_le_bytes_constraints = {},
+                                  .bigint_to_le_bytes_constraints = {},
+                                  .bigint_operations = {},
+                                  .constraints = { expr_a, expr_b, expr_c, expr_d },
+                                  .block_constraints = {} };
+
+    const auto make_witness = [](uint32_t x, uint32_t y) {
+        const fr z(x ^ y);
+        return WitnessVector{ x, y, z, z - 10, (z - 10).invert(), 1 };
+    };
+
+    auto builder = create_circuit(constraint_system, /*size_hint*/ 0, make_witness(5, 10));
+    auto composer = Composer();
+    {
+        auto prover = composer.create_ultra_with_keccak_prover(builder);
+        auto verifier = composer.create_ultra_with_keccak_verifier(builder);
+        EXPECT_TRUE(verifier.verify_proof(prover.construct_proof()));
+    }
+
+    const auto witness = make_witness(0xdeadbeef, 0x1234);
+    EXPECT_TRUE(replay_witness(builder, constraint_system, witness));
+    EXPECT_TRUE(builder.check_circuit());
+
+    auto expected = create_circuit(constraint_system, /*size_hint*/ 0, witness);
+    expected.finalize_circuit();
+    EXPECT_EQ(builder.variables, expected.variables);
+    EXPECT_EQ(builder.get_public_inputs(), expected.get_public_inputs());
+
+    composer.update_witness(builder);
+    auto prover = composer.create_ultra_with_keccak_prover(builder);
+    auto verifier = composer.create_ultra_with_keccak_verifier(builder);
+    EXPECT_TRUE(verifier.verify_proof(prover.construct_proof()));
+
+    // An unsatisfying witness is replayed as well, and caught by the frozen constraints
+    auto bad_witness = make_witness(6, 10);
+    bad_witness[3] += 1;
+    EXPECT_TRUE(replay_witness(builder, constraint_system, bad_witness));
+    EXPECT_FALSE(builder.check_circuit());
+}
@@ -33,6 +33,36 @@ void AcirComposer::create_circuit(acir_format::AcirFormat& constraint_system, Wi
     vinfo("circuit is recursive friendly: ", builder_.is_recursive_circuit);
 }
 
+/**
+ * @brief Swap in a new witness for the circuit previously built from the same constraint system
+ *
+ * @details Where possible the witness is replayed onto the existing circuit, so that the proving key computed for it
+ * stays valid and only its witness polynomials are refreshed. Otherwise the circuit (and proving key, if any) is
+ * rebuilt from scratch.
+ *
+ * @param constraint_system
+ * @param witness
+ */
+void AcirComposer::update_witness(acir_format::AcirFormat& constraint_system, WitnessVector const& witness)
+{
+    vinfo("replaying witness...");
+    if (acir_format::replay_witness(builder_, constraint_system, witness)) {
+        if (proving_key_) {
+            acir_format::Composer composer(proving_key_, nullptr);
+            composer.update_witness(builder_);
+        }
+        return;
+    }
+
+    vinfo("witness cannot be replayed, rebuilding circuit");
+    const bool had_proving_key = proving_key_ != nullptr;
+    create_circuit(constraint_system, witness);
+    if (had_proving_key) {
+        proving_key_ = nullptr;
+        init_proving_key();
+    }
+}
+
 std::shared_ptr<bb::plonk::proving_key> AcirComposer::init_proving_key()
 {
     acir_format::Composer composer;
@@ -19,6 +19,8 @@ class AcirComposer {
     template <typename Builder = UltraCircuitBuilder>
     void create_circuit(acir_format::AcirFormat& constraint_system, WitnessVector const& witness = {});
 
+    void update_witness(acir_format::AcirFormat& constraint_system, WitnessVector const& witness);
+
     std::shared_ptr<bb::plonk::proving_key> init_proving_key();
 
     std::vector<uint8_t> create_proof();
@@ -374,4 +374,44 @@ TEST(fr, Uint256Conversions)
 
     static_assert(a == c);
     EXPECT_EQ(a, c);
-}
\ No newline at end of file
+}
+
+namespace {
+// fr with montgomery_mul / montgomery_square pinned to the 9 x 29 bit limb backend that WASM builds use by default
+class Bn254FrParams29 : public Bn254FrParams {
+  public:
+    static constexpr size_t montgomery_limb_bits = 29;
+};
+using fr29 = field<Bn254FrParams29>;
+
+fr29 to_fr29(const fr& a)
+{
+    return { a.data[0], a.data[1], a.data[2], a.data[3] };
+}
+} // namespace
+
+TEST(fr, MontgomeryMul29BitLimbsIsBitIdentical)
+{
+    static_assert(fr29::montgomery_limb_bits == 29);
+    constexpr fr a{ 0x192f9ddc938ea63, 0x1db93d61007ec4fe, 0xc89284ec31fa49c0, 0x2478d0ff12b04f0f };
+    constexpr fr29 a29{ a.data[0], a.data[1], a.data[2], a.data[3] };
+    static_assert(a29.montgomery_mul(a29).data[3] == a.montgomery_mul(a).data[3]);
+
+    for (size_t i = 0; i < 1000; ++i) {
+        fr x = fr::random_element();
+        fr y = fr::random_element();
+        // Also cover the coarse range [p, 2p) that mul and sqr accept and return
+        if (i % 2 == 1) {
+            const uint256_t coarse = uint256_t(x.data[0], x.data[1], x.data[2], x.data[3]) + fr::modulus;
+            x = fr{ coarse.data[0], coarse.data[1], coarse.data[2], coarse.data[3] };
+        }
+        const fr expected_mul = x.montgomery_mul(y);
+        const fr expected_sqr = x.montgomery_square();
+        const fr29 result_mul = to_fr29(x).montgomery_mul(to_fr29(y));
+        const fr29 result_sqr = to_fr29(x).montgomery_square();
+        for (size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(result_mul.data[j], expected_mul.data[j]);
+            EXPECT_EQ(result_sqr.data[j], expected_sqr.data[j]);
+        }
+    }
+}
@@ -127,4 +127,18 @@ TEST(pairing, ReducedAtePairingPrecomputeConsistencyCheckBatch)
     fq12 expected = pairing::reduced_ate_pairing_batch(&P_b[0], &Q_b[0], num_points).from_montgomery_form();
 
     EXPECT_EQ(result, expected);
-}
\ No newline at end of file
+}
+TEST(pairing, MillerLoopBatchParallelConsistency)
+{
+    constexpr size_t num_points = 17;
+    std::vector<g1::element> P(num_points);
+    std::vector<pairing::miller_lines> lines(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        P[i] = g1::element(g1::affine_element(g1::element::random_element()));
+        pairing::precompute_miller_lines(g2::element(g2::affine_element(g2::element::random_element())), lines[i]);
+    }
+    fq12 result = pairing::miller_loop_batch_parallel(&P[0], &lines[0], num_points).from_montgomery_form();
+    fq12 expected = pairing::miller_loop_batch(&P[0], &lines[0], num_points).from_montgomery_form();
+
+    EXPECT_EQ(result, expected);
+}
@@ -202,6 +202,33 @@ constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines*
     return work_scalar;
 }
 
+/**
+ * @brief Compute the same value as miller_loop_batch, splitting the pairs into chunks that are processed in parallel
+ * @details The batched Miller loop is the product of the Miller loops of the individual pairs, so each thread runs
+ * miller_loop_batch over its own chunk and the partial results are multiplied together.
+ */
+inline fq12 miller_loop_batch_parallel(const g1::element* points, const miller_lines* lines, const size_t num_pairs)
+{
+    const size_t num_threads = std::min(get_num_cpus(), num_pairs / min_pairs_per_thread);
+    if (num_threads <= 1) {
+        return miller_loop_batch(points, lines, num_pairs);
+    }
+    const size_t pairs_per_thread = (num_pairs + num_threads - 1) / num_threads;
+    std::vector<fq12> partial_results(num_threads, fq12::one());
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * pairs_per_thread;
+        const size_t end = std::min(start + pairs_per_thread, num_pairs);
+        if (start < end) {
+            partial_results[thread_idx] = miller_loop_batch(points + start, lines + start, end - start);
+        }
+    });
+    fq12 result = partial_results[0];
+    for (size_t i = 1; i < num_threads; ++i) {
+        result *= partial_results[i];
+    }
+    return result;
+}
+
 constexpr fq12 final_exponentiation_easy_part(const fq12& elt)
 {
     fq12 a{ elt.c0, -elt.c1 };
@@ -271,7 +298,7 @@ fq12 reduced_ate_pairing_batch_precomputed(const g1::affine_element* P_affines,
     for (size_t i = 0; i < num_points; ++i) {
         P[i] = g1::element(P_affines[i]);
     }
-    fq12 result = miller_loop_batch(&P[0], &lines[0], num_points);
+    fq12 result = miller_loop_batch_parallel(&P[0], &lines[0], num_points);
     result = final_exponentiation_easy_part(result);
     result = final_exponentiation_tricky_part(result);
     return result;
@@ -285,14 +312,19 @@ fq12 reduced_ate_pairing_batch(const g1::affine_element* P_affines,
     std::vector<g2::element> Q(num_points);
     std::vector<miller_lines> lines(num_points);
 
-    for (size_t i = 0; i < num_points; ++i) {
-        P[i] = g1::element(P_affines[i]);
-        Q[i] = g2::element(Q_affines[i]);
+    run_loop_in_parallel(
+        num_points,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                P[i] = g1::element(P_affines[i]);
+                Q[i] = g2::element(Q_affines[i]);
 
-        precompute_miller_lines(Q[i], lines[i]);
-    }
+                precompute_miller_lines(Q[i], lines[i]);
+            }
+        },
+        /*no_multhreading_if_less_or_equal=*/1);
 
-    fq12 result = miller_loop_batch(&P[0], &lines[0], num_points);
+    fq12 result = miller_loop_batch_parallel(&P[0], &lines[0], num_points);
     result = final_exponentiation_easy_part(result);
     result = final_exponentiation_tricky_part(result);
     return result;
@@ -44,6 +44,17 @@ grumpkin::fr convert_grumpkin_fr_from_bn254_frs(std::span<const bb::fr> fr_vec)
  * @return std::array<bb::fr, 2>
  */
 std::vector<bb::fr> convert_grumpkin_fr_to_bn254_frs(const grumpkin::fr& val)
+{
+    std::vector<bb::fr> result;
+    result.reserve(2);
+    append_grumpkin_fr_to_bn254_frs(val, result);
+    return result;
+}
+
+/**
+ * @brief Appends the 2 bb::fr elements of convert_grumpkin_fr_to_bn254_frs to fr_vec
+ */
+void append_grumpkin_fr_to_bn254_frs(const grumpkin::fr& val, std::vector<bb::fr>& fr_vec)
 {
     // Goal is to slice up the 64 bit limbs of grumpkin::fr/uint256_t to mirror the 68 bit limbs of bigfield
     // We accomplish this by dividing the grumpkin::fr's value into two 68*2=136 bit pieces.
@@ -51,11 +62,9 @@ std::vector<bb::fr> convert_grumpkin_fr_to_bn254_frs(const grumpkin::fr& val)
     constexpr uint256_t LOWER_MASK = (uint256_t(1) << LOWER_BITS) - 1;
     auto value = uint256_t(val);
     ASSERT(value < (uint256_t(1) << TOTAL_BITS));
-    std::vector<bb::fr> result(2);
-    result[0] = static_cast<uint256_t>(value & LOWER_MASK);
-    result[1] = static_cast<uint256_t>(value >> LOWER_BITS);
-    ASSERT(static_cast<uint256_t>(result[1]) < (uint256_t(1) << (TOTAL_BITS - LOWER_BITS)));
-    return result;
+    fr_vec.emplace_back(static_cast<uint256_t>(value & LOWER_MASK));
+    fr_vec.emplace_back(static_cast<uint256_t>(value >> LOWER_BITS));
+    ASSERT(static_cast<uint256_t>(fr_vec.back()) < (uint256_t(1) << (TOTAL_BITS - LOWER_BITS)));
 }
 
 grumpkin::fr convert_to_grumpkin_fr(const bb::fr& f)
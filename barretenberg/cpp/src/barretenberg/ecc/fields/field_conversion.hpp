@@ -77,40 +77,49 @@ template <typename T> T convert_from_bn254_frs(std::span<const bb::fr> fr_vec)
 }
 
 std::vector<bb::fr> convert_grumpkin_fr_to_bn254_frs(const grumpkin::fr& val);
+void append_grumpkin_fr_to_bn254_frs(const grumpkin::fr& val, std::vector<bb::fr>& fr_vec);
 
 /**
- * @brief Conversion from transcript values to bb::frs
- * @details We want to support the following types: bool, size_t, uint32_t, uint64_t, bb::fr, grumpkin::fr,
- * curve::BN254::AffineElement, curve::Grumpkin::AffineElement, bb::Univariate<FF, N>, std::array<FF, N>, for
- * FF = bb::fr/grumpkin::fr, and N is arbitrary.
+ * @brief Appends the bb::fr representation of a transcript value to fr_vec
+ * @details Produces the same elements as convert_to_bn254_frs, but writes them into an existing buffer, so that
+ * serializing a value (e.g. into a proof) doesn't allocate a vector per value and per limb.
  * @tparam T
  * @param val
- * @return std::vector<bb::fr>
+ * @param fr_vec
  */
-template <typename T> std::vector<bb::fr> convert_to_bn254_frs(const T& val)
+template <typename T> void append_to_bn254_frs(const T& val, std::vector<bb::fr>& fr_vec)
 {
     if constexpr (IsAnyOf<T, bool, uint32_t, bb::fr>) {
-        std::vector<bb::fr> fr_vec{ val };
-        return fr_vec;
+        fr_vec.emplace_back(val);
     } else if constexpr (IsAnyOf<T, grumpkin::fr>) {
-        return convert_grumpkin_fr_to_bn254_frs(val);
+        append_grumpkin_fr_to_bn254_frs(val, fr_vec);
     } else if constexpr (IsAnyOf<T, curve::BN254::AffineElement, curve::Grumpkin::AffineElement>) {
-        auto fr_vec_x = convert_to_bn254_frs(val.x);
-        auto fr_vec_y = convert_to_bn254_frs(val.y);
-        std::vector<bb::fr> fr_vec(fr_vec_x.begin(), fr_vec_x.end());
-        fr_vec.insert(fr_vec.end(), fr_vec_y.begin(), fr_vec_y.end());
-        return fr_vec;
+        append_to_bn254_frs(val.x, fr_vec);
+        append_to_bn254_frs(val.y, fr_vec);
     } else {
         // Array or Univariate
-        std::vector<bb::fr> fr_vec;
         for (auto& x : val) {
-            auto tmp_vec = convert_to_bn254_frs(x);
-            fr_vec.insert(fr_vec.end(), tmp_vec.begin(), tmp_vec.end());
+            append_to_bn254_frs(x, fr_vec);
         }
-        return fr_vec;
     }
 }
 
+/**
+ * @brief Conversion from transcript values to bb::frs
+ * @details We want to support the following types: bool, size_t, uint32_t, uint64_t, bb::fr, grumpkin::fr,
+ * curve::BN254::AffineElement, curve::Grumpkin::AffineElement, bb::Univariate<FF, N>, std::array<FF, N>, for
+ * FF = bb::fr/grumpkin::fr, and N is arbitrary.
+ * @tparam T
+ * @param val
+ * @return std::vector<bb::fr>
+ */
+template <typename T> std::vector<bb::fr> convert_to_bn254_frs(const T& val)
+{
+    std::vector<bb::fr> fr_vec;
+    append_to_bn254_frs(val, fr_vec);
+    return fr_vec;
+}
+
 grumpkin::fr convert_to_grumpkin_fr(const bb::fr& f);
 
 template <typename T> T inline convert_challenge(const bb::fr& challenge)
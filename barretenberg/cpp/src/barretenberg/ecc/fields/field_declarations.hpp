@@ -20,6 +20,26 @@
 #define BBERG_NO_ASM 1
 #endif
 
+// Limb width of the portable montgomery_mul / montgomery_square in field_impl_generic.hpp. Elements are always stored
+// as 4 x 64 bit words, this only changes how the product is formed. There are two choices: the platform default
+// (BBERG_FIELD_NATIVE_LIMB_BITS: 4 x 64 bit limbs where a native 64x64->128 bit multiply exists, 8 x 32 bit limbs
+// otherwise) or 29, which selects 9 x 29 bit limbs: every partial product fits in a uint64 with enough headroom to sum
+// a whole column, so carries are propagated once per reduction round instead of after every multiply-add. wasm32 and
+// 32 bit ARM don't have a 128 bit multiply, so there 29 is the default.
+#if defined(__SIZEOF_INT128__) && !defined(__wasm__)
+#define BBERG_FIELD_NATIVE_LIMB_BITS 64
+#else
+#define BBERG_FIELD_NATIVE_LIMB_BITS 32
+#endif
+
+#ifndef BBERG_FIELD_LIMB_BITS
+#if BBERG_FIELD_NATIVE_LIMB_BITS == 64
+#define BBERG_FIELD_LIMB_BITS 64
+#else
+#define BBERG_FIELD_LIMB_BITS 29
+#endif
+#endif
+
 namespace bb {
 template <class Params_> struct alignas(32) field {
   public:
@@ -160,6 +180,17 @@ template <class Params_> struct alignas(32) field {
     static constexpr uint256_t modulus =
         uint256_t{ Params::modulus_0, Params::modulus_1, Params::modulus_2, Params::modulus_3 };
 
+    // Limb width of montgomery_mul / montgomery_square (see BBERG_FIELD_LIMB_BITS). A Params struct can pin it with
+    // `static constexpr size_t montgomery_limb_bits = 29;`, which is how the tests exercise the 29 bit code natively.
+    static constexpr size_t montgomery_limb_bits = []() {
+        if constexpr (requires { Params::montgomery_limb_bits; }) {
+            return static_cast<size_t>(Params::montgomery_limb_bits);
+        }
+        return static_cast<size_t>(BBERG_FIELD_LIMB_BITS);
+    }();
+    static_assert(montgomery_limb_bits == 29 || montgomery_limb_bits == BBERG_FIELD_NATIVE_LIMB_BITS,
+                  "montgomery_limb_bits must be 29 or the platform default BBERG_FIELD_NATIVE_LIMB_BITS");
+
     static constexpr field cube_root_of_unity()
     {
         // endomorphism i.e. lambda * [P] = (beta * x, y)
@@ -553,6 +584,10 @@ template <class Params_> struct alignas(32) field {
     BB_INLINE constexpr field montgomery_mul(const field& other) const noexcept;
     BB_INLINE constexpr field montgomery_mul_big(const field& other) const noexcept;
     BB_INLINE constexpr field montgomery_square() const noexcept;
+    BB_INLINE constexpr field montgomery_mul_29(const field& other) const noexcept;
+    BB_INLINE constexpr field montgomery_square_29() const noexcept;
+    BB_INLINE static constexpr std::array<uint64_t, 9> split_into_29_bit_limbs(const field& a) noexcept;
+    BB_INLINE static constexpr field montgomery_reduce_29(std::array<uint64_t, 18>& t) noexcept;
 
 #if (BBERG_NO_ASM == 0)
     BB_INLINE static field asm_mul(const field& a, const field& b) noexcept;
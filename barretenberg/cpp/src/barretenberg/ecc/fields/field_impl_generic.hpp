@@ -419,6 +419,9 @@ template <class T> constexpr field<T> field<T>::montgomery_mul(const field& othe
     if constexpr (modulus.data[3] >= 0x4000000000000000ULL) {
         return montgomery_mul_big(other);
     }
+    if constexpr (montgomery_limb_bits == 29) {
+        return montgomery_mul_29(other);
+    }
 #if defined(__SIZEOF_INT128__) && !defined(__wasm__)
     auto [t0, c] = mul_wide(data[0], other.data[0]);
     uint64_t k = t0 * T::r_inv;
@@ -646,6 +649,9 @@ template <class T> constexpr field<T> field<T>::montgomery_square() const noexce
     if constexpr (modulus.data[3] >= 0x4000000000000000ULL) {
         return montgomery_mul_big(*this);
     }
+    if constexpr (montgomery_limb_bits == 29) {
+        return montgomery_square_29();
+    }
 #if defined(__SIZEOF_INT128__) && !defined(__wasm__)
     uint64_t carry_hi = 0;
 
@@ -701,6 +707,105 @@ template <class T> constexpr field<T> field<T>::montgomery_square() const noexce
 #endif
 }
 
+/**
+ * @brief Split a field element into 9 limbs of 29 bits (the top limb holds the remaining 24 bits)
+ */
+template <class T> constexpr std::array<uint64_t, 9> field<T>::split_into_29_bit_limbs(const field& a) noexcept
+{
+    constexpr uint64_t mask = (1ULL << 29) - 1;
+    std::array<uint64_t, 9> limbs{};
+    for (size_t i = 0; i < 9; ++i) {
+        const size_t word = (i * 29) / 64;
+        const size_t shift = (i * 29) % 64;
+        uint64_t limb = a.data[word] >> shift;
+        if (shift > 35 && word < 3) {
+            limb |= a.data[word + 1] << (64 - shift);
+        }
+        limbs[i] = limb & mask;
+    }
+    return limbs;
+}
+
+/**
+ * @brief Montgomery-reduce a product held in 29 bit columns, t = sum(t[i] * 2^{29i}), returning t / 2^256 mod p
+ *
+ * @details The columns are not normalized: each one is the raw sum of up to 9 limb products (< 2^62). Every round
+ * picks a 29 bit k that clears the bottom column, adds k * p (another 9 products < 2^58 per column, so a column stays
+ * below 2^63) and pushes what is left of the column up into the next one. 8 such rounds divide by 2^232, a final 24 bit
+ * round makes it 2^256. That is the same unique k < 2^256 the 64 bit CIOS loop picks, so the result is bit for bit the
+ * same as the other backends, and with inputs < 2p (moduli < 2^254) it is < 2p as usual.
+ */
+template <class T> constexpr field<T> field<T>::montgomery_reduce_29(std::array<uint64_t, 18>& t) noexcept
+{
+    constexpr uint64_t mask = (1ULL << 29) - 1;
+    constexpr std::array<uint64_t, 9> p = split_into_29_bit_limbs(field{ modulus.data[0],
+                                                                         modulus.data[1],
+                                                                         modulus.data[2],
+                                                                         modulus.data[3] });
+    for (size_t i = 0; i < 8; ++i) {
+        const uint64_t k = (t[i] * T::r_inv) & mask;
+        for (size_t j = 0; j < 9; ++j) {
+            t[i + j] += k * p[j];
+        }
+        t[i + 1] += t[i] >> 29;
+    }
+    for (size_t i = 8; i < 17; ++i) {
+        t[i + 1] += t[i] >> 29;
+        t[i] &= mask;
+    }
+
+    // t[8..17] now holds the partially reduced value in normalized 29 bit limbs
+    const uint64_t k = (t[8] * T::r_inv) & ((1ULL << 24) - 1);
+    for (size_t j = 0; j < 9; ++j) {
+        t[8 + j] += k * p[j];
+    }
+    for (size_t i = 8; i < 17; ++i) {
+        t[i + 1] += t[i] >> 29;
+        t[i] &= mask;
+    }
+
+    // Repack, dropping the 24 low bits that the last round cleared
+    field result{ 0, 0, 0, 0 };
+    result.data[0] = t[8] >> 24;
+    for (size_t i = 1; i < 10; ++i) {
+        const size_t bit = (i * 29) - 24;
+        const size_t word = bit / 64;
+        const size_t shift = bit % 64;
+        result.data[word] |= t[8 + i] << shift;
+        if (shift > 35 && word < 3) {
+            result.data[word + 1] |= t[8 + i] >> (64 - shift);
+        }
+    }
+    return result;
+}
+
+template <class T> constexpr field<T> field<T>::montgomery_mul_29(const field& other) const noexcept
+{
+    const std::array<uint64_t, 9> left = split_into_29_bit_limbs(*this);
+    const std::array<uint64_t, 9> right = split_into_29_bit_limbs(other);
+    std::array<uint64_t, 18> t{};
+    for (size_t i = 0; i < 9; ++i) {
+        for (size_t j = 0; j < 9; ++j) {
+            t[i + j] += left[i] * right[j];
+        }
+    }
+    return montgomery_reduce_29(t);
+}
+
+template <class T> constexpr field<T> field<T>::montgomery_square_29() const noexcept
+{
+    const std::array<uint64_t, 9> limbs = split_into_29_bit_limbs(*this);
+    std::array<uint64_t, 18> t{};
+    for (size_t i = 0; i < 9; ++i) {
+        t[2 * i] += limbs[i] * limbs[i];
+        const uint64_t doubled = limbs[i] << 1;
+        for (size_t j = i + 1; j < 9; ++j) {
+            t[i + j] += doubled * limbs[j];
+        }
+    }
+    return montgomery_reduce_29(t);
+}
+
 template <class T> constexpr struct field<T>::wide_array field<T>::mul_512(const field& other) const noexcept {
 #if defined(__SIZEOF_INT128__) && !defined(__wasm__)
     uint64_t carry_2 = 0;
@@ -213,4 +213,35 @@ TEST(AffineElement, InfinityBatchMulByScalarIsInfinity)
         grumpkin::g1::element::batch_mul_with_endomorphism(affine_points, grumpkin::fr::random_element());
 
     EXPECT_THAT(result, Each(Property(&grumpkin::g1::affine_element::is_point_at_infinity, Eq(true))));
+}
+
+// Fused batched multiplication and addition should match multiplication followed by addition, also when the scratch
+// space is reused between calls of different sizes
+TEST(AffineElement, BatchMulAndAddMatchesNonBatchMulAndAdd)
+{
+    using affine_element = grumpkin::g1::affine_element;
+    using element = grumpkin::g1::element;
+    element::BatchMulScratchSpace scratch_space;
+    for (const size_t num_points : { 512UL, 37UL }) {
+        std::vector<affine_element> points(num_points);
+        std::vector<affine_element> accumulators(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            points[i] = affine_element(element::random_element());
+            accumulators[i] = affine_element(element::random_element());
+        }
+        // Include points at infinity on either side and a pair that sums to infinity
+        points[1] = affine_element::infinity();
+        accumulators[2] = affine_element::infinity();
+        const grumpkin::fr exponent = grumpkin::fr::random_element();
+        accumulators[3] = -(points[3] * exponent);
+
+        std::vector<affine_element> expected;
+        for (size_t i = 0; i < num_points; ++i) {
+            expected.emplace_back(element(accumulators[i]) + element(points[i] * exponent));
+        }
+
+        element::batch_mul_with_endomorphism_and_add(accumulators, points, exponent, scratch_space);
+
+        EXPECT_THAT(accumulators, ElementsAreArray(expected));
+    }
 }
\ No newline at end of file
@@ -97,6 +97,19 @@ template <class Fq, class Fr, class Params> class alignas(32) element {
     static std::vector<affine_element<Fq, Fr, Params>> batch_mul_with_endomorphism(
         const std::span<affine_element<Fq, Fr, Params>>& points, const Fr& scalar) noexcept;
 
+    /**
+     * @brief Buffers used by batch_mul_with_endomorphism_and_add. Can be reused across calls to avoid reallocating
+     * the lookup tables and batch inversion scratch space every time.
+     */
+    struct BatchMulScratchSpace {
+        std::vector<affine_element<Fq, Fr, Params>> points;
+        std::vector<Fq> field_elements;
+    };
+    static void batch_mul_with_endomorphism_and_add(const std::span<affine_element<Fq, Fr, Params>>& accumulators,
+                                                    const std::span<const affine_element<Fq, Fr, Params>>& points,
+                                                    const Fr& scalar,
+                                                    BatchMulScratchSpace& scratch_space) noexcept;
+
     Fq x;
     Fq y;
     Fq z;
@@ -107,6 +120,14 @@ template <class Fq, class Fr, class Params> class alignas(32) element {
     element mul_without_endomorphism(const Fr& scalar) const noexcept;
     element mul_with_endomorphism(const Fr& scalar) const noexcept;
 
+    static void batch_affine_add_chunked(const affine_element<Fq, Fr, Params>* lhs,
+                                         affine_element<Fq, Fr, Params>* rhs,
+                                         size_t point_count,
+                                         Fq* personal_scratch_space) noexcept;
+    static void batch_affine_double_chunked(affine_element<Fq, Fr, Params>* lhs,
+                                            size_t point_count,
+                                            Fq* personal_scratch_space) noexcept;
+
     template <typename = typename std::enable_if<Params::can_hash_to_curve>>
     static element random_coordinates_on_curve(numeric::RNG* engine = nullptr) noexcept;
     // {
@@ -706,6 +706,75 @@ element<Fq, Fr, T> element<Fq, Fr, T>::mul_with_endomorphism(const Fr& scalar) c
     return accumulator;
 }
 
+/**
+ * @brief Perform point addition rhs[i]=rhs[i]+lhs[i] with batch inversion
+ * @details We can mutate rhs but NOT lhs, the output is stored in rhs. The points must not be at infinity and must
+ * have distinct x-coordinates.
+ *
+ */
+template <class Fq, class Fr, class T>
+void element<Fq, Fr, T>::batch_affine_add_chunked(const affine_element<Fq, Fr, T>* lhs,
+                                                  affine_element<Fq, Fr, T>* rhs,
+                                                  const size_t point_count,
+                                                  Fq* personal_scratch_space) noexcept
+{
+    Fq batch_inversion_accumulator = Fq::one();
+
+    for (size_t i = 0; i < point_count; i += 1) {
+        personal_scratch_space[i] = lhs[i].x + rhs[i].x; // x2 + x1
+        rhs[i].x -= lhs[i].x;                            // x2 - x1
+        rhs[i].y -= lhs[i].y;                            // y2 - y1
+        rhs[i].y *= batch_inversion_accumulator;         // (y2 - y1)*accumulator_old
+        batch_inversion_accumulator *= (rhs[i].x);
+    }
+    batch_inversion_accumulator = batch_inversion_accumulator.invert();
+
+    for (size_t i = (point_count)-1; i < point_count; i -= 1) {
+        rhs[i].y *= batch_inversion_accumulator; // update accumulator
+        batch_inversion_accumulator *= rhs[i].x;
+        rhs[i].x = rhs[i].y.sqr();
+        rhs[i].x = rhs[i].x - (personal_scratch_space[i]); // x3 = lambda_squared - x2
+                                                           // - x1
+        personal_scratch_space[i] = lhs[i].x - rhs[i].x;
+        personal_scratch_space[i] *= rhs[i].y;
+        rhs[i].y = personal_scratch_space[i] - lhs[i].y;
+    }
+}
+
+/**
+ * @brief Perform point doubling lhs[i]=lhs[i]+lhs[i] with batch inversion
+ *
+ */
+template <class Fq, class Fr, class T>
+void element<Fq, Fr, T>::batch_affine_double_chunked(affine_element<Fq, Fr, T>* lhs,
+                                                     const size_t point_count,
+                                                     Fq* personal_scratch_space) noexcept
+{
+    Fq batch_inversion_accumulator = Fq::one();
+
+    for (size_t i = 0; i < point_count; i += 1) {
+
+        personal_scratch_space[i] = lhs[i].x.sqr();
+        personal_scratch_space[i] = personal_scratch_space[i] + personal_scratch_space[i] + personal_scratch_space[i];
+
+        personal_scratch_space[i] *= batch_inversion_accumulator;
+
+        batch_inversion_accumulator *= (lhs[i].y + lhs[i].y);
+    }
+    batch_inversion_accumulator = batch_inversion_accumulator.invert();
+
+    Fq temp;
+    for (size_t i = (point_count)-1; i < point_count; i -= 1) {
+
+        personal_scratch_space[i] *= batch_inversion_accumulator;
+        batch_inversion_accumulator *= (lhs[i].y + lhs[i].y);
+
+        temp = lhs[i].x;
+        lhs[i].x = personal_scratch_space[i].sqr() - (lhs[i].x + lhs[i].x);
+        lhs[i].y = personal_scratch_space[i] * (temp - lhs[i].x) - lhs[i].y;
+    }
+}
+
 /**
  * @brief Pairwise affine add points in first and second group
  *
@@ -740,47 +809,15 @@ void element<Fq, Fr, T>::batch_affine_add(const std::span<affine_element<Fq, Fr,
         /*scalar_multiplications_per_iteration=*/0,
         /*sequential_copy_ops_per_iteration=*/2);
 
-    // TODO(#826): Same code as in batch mul
-    //  we can mutate rhs but NOT lhs!
-    //  output is stored in rhs
-    /**
-     * @brief Perform point addition rhs[i]=rhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_add_chunked =
-        [](const affine_element* lhs, affine_element* rhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-                personal_scratch_space[i] = lhs[i].x + rhs[i].x; // x2 + x1
-                rhs[i].x -= lhs[i].x;                            // x2 - x1
-                rhs[i].y -= lhs[i].y;                            // y2 - y1
-                rhs[i].y *= batch_inversion_accumulator;         // (y2 - y1)*accumulator_old
-                batch_inversion_accumulator *= (rhs[i].x);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-                rhs[i].y *= batch_inversion_accumulator; // update accumulator
-                batch_inversion_accumulator *= rhs[i].x;
-                rhs[i].x = rhs[i].y.sqr();
-                rhs[i].x = rhs[i].x - (personal_scratch_space[i]); // x3 = lambda_squared - x2
-                                                                   // - x1
-                personal_scratch_space[i] = lhs[i].x - rhs[i].x;
-                personal_scratch_space[i] *= rhs[i].y;
-                rhs[i].y = personal_scratch_space[i] - lhs[i].y;
-            }
-        };
-
     /**
      * @brief Perform batch affine addition in parallel
      *
      */
     const auto batch_affine_add_internal =
-        [num_points, &scratch_space, &batch_affine_add_chunked](const affine_element* lhs, affine_element* rhs) {
+        [num_points, &scratch_space](const affine_element* lhs, affine_element* rhs) {
             run_loop_in_parallel_if_effective(
                 num_points,
-                [lhs, &rhs, &scratch_space, &batch_affine_add_chunked](size_t start, size_t end) {
+                [lhs, &rhs, &scratch_space](size_t start, size_t end) {
                     batch_affine_add_chunked(lhs + start, rhs + start, end - start, &scratch_space[0] + start);
                 },
                 /*finite_field_additions_per_iteration=*/6,
@@ -810,92 +847,29 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
     // Space for temporary values
     std::vector<Fq> scratch_space(num_points);
 
-    // TODO(#826): Same code as in batch add
-    //  we can mutate rhs but NOT lhs!
-    //  output is stored in rhs
-    /**
-     * @brief Perform point addition rhs[i]=rhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_add_chunked =
-        [](const affine_element* lhs, affine_element* rhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-                personal_scratch_space[i] = lhs[i].x + rhs[i].x; // x2 + x1
-                rhs[i].x -= lhs[i].x;                            // x2 - x1
-                rhs[i].y -= lhs[i].y;                            // y2 - y1
-                rhs[i].y *= batch_inversion_accumulator;         // (y2 - y1)*accumulator_old
-                batch_inversion_accumulator *= (rhs[i].x);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-                rhs[i].y *= batch_inversion_accumulator; // update accumulator
-                batch_inversion_accumulator *= rhs[i].x;
-                rhs[i].x = rhs[i].y.sqr();
-                rhs[i].x = rhs[i].x - (personal_scratch_space[i]); // x3 = lambda_squared - x2
-                                                                   // - x1
-                personal_scratch_space[i] = lhs[i].x - rhs[i].x;
-                personal_scratch_space[i] *= rhs[i].y;
-                rhs[i].y = personal_scratch_space[i] - lhs[i].y;
-            }
-        };
-
     /**
      * @brief Perform batch affine addition in parallel
      *
      */
     const auto batch_affine_add_internal =
-        [num_points, &scratch_space, &batch_affine_add_chunked](const affine_element* lhs, affine_element* rhs) {
+        [num_points, &scratch_space](const affine_element* lhs, affine_element* rhs) {
             run_loop_in_parallel_if_effective(
                 num_points,
-                [lhs, &rhs, &scratch_space, &batch_affine_add_chunked](size_t start, size_t end) {
+                [lhs, &rhs, &scratch_space](size_t start, size_t end) {
                     batch_affine_add_chunked(lhs + start, rhs + start, end - start, &scratch_space[0] + start);
                 },
                 /*finite_field_additions_per_iteration=*/6,
                 /*finite_field_multiplications_per_iteration=*/6);
         };
 
-    /**
-     * @brief Perform point doubling lhs[i]=lhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_double_chunked =
-        [](affine_element* lhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-
-                personal_scratch_space[i] = lhs[i].x.sqr();
-                personal_scratch_space[i] =
-                    personal_scratch_space[i] + personal_scratch_space[i] + personal_scratch_space[i];
-
-                personal_scratch_space[i] *= batch_inversion_accumulator;
-
-                batch_inversion_accumulator *= (lhs[i].y + lhs[i].y);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            Fq temp;
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-
-                personal_scratch_space[i] *= batch_inversion_accumulator;
-                batch_inversion_accumulator *= (lhs[i].y + lhs[i].y);
-
-                temp = lhs[i].x;
-                lhs[i].x = personal_scratch_space[i].sqr() - (lhs[i].x + lhs[i].x);
-                lhs[i].y = personal_scratch_space[i] * (temp - lhs[i].x) - lhs[i].y;
-            }
-        };
     /**
      * @brief Perform point doubling in parallel
      *
      */
-    const auto batch_affine_double = [num_points, &scratch_space, &batch_affine_double_chunked](affine_element* lhs) {
+    const auto batch_affine_double = [num_points, &scratch_space](affine_element* lhs) {
         run_loop_in_parallel_if_effective(
             num_points,
-            [&lhs, &scratch_space, &batch_affine_double_chunked](size_t start, size_t end) {
+            [&lhs, &scratch_space](size_t start, size_t end) {
                 batch_affine_double_chunked(lhs + start, end - start, &scratch_space[0] + start);
             },
             /*finite_field_additions_per_iteration=*/7,
@@ -1107,6 +1081,148 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
     return work_elements;
 }
 
+/**
+ * @brief Compute accumulators[i] += scalar⋅points[i] for all i
+ *
+ * @details Equivalent to batch_mul_with_endomorphism followed by batch_affine_add, but each thread runs the whole
+ * windowed scalar multiplication over its own chunk of points, so there is a single parallel loop per call instead of
+ * one per doubling/addition step. The final addition into the accumulators is fused into the same pass and all
+ * temporaries live in the provided scratch space, which is grown as necessary and can be reused across calls (e.g.
+ * across the rounds of the IPA prover, where this computes G_vec_lo + u⁻¹⋅G_vec_hi).
+ *
+ * @param accumulators Points that the products are added to (in place)
+ * @param points The points to be scaled, of the same size as accumulators
+ * @param scalar The scalar all points are multiplied by
+ * @param scratch_space Reusable buffers
+ */
+template <class Fq, class Fr, class T>
+void element<Fq, Fr, T>::batch_mul_with_endomorphism_and_add(
+    const std::span<affine_element<Fq, Fr, T>>& accumulators,
+    const std::span<const affine_element<Fq, Fr, T>>& points,
+    const Fr& scalar,
+    BatchMulScratchSpace& scratch_space) noexcept
+{
+    BB_OP_COUNT_TIME();
+    typedef affine_element<Fq, Fr, T> affine_element;
+    constexpr size_t LOOKUP_SIZE = 8;
+    constexpr size_t NUM_ROUNDS = 32;
+    // Each point needs a lookup table, an addend and a working element
+    constexpr size_t POINTS_PER_ENTRY = LOOKUP_SIZE + 2;
+    const size_t num_points = points.size();
+    ASSERT(accumulators.size() == num_points);
+
+    const Fr converted_scalar = scalar.from_montgomery_form();
+    if (converted_scalar.is_zero() || num_points == 0) {
+        return;
+    }
+
+    if (scratch_space.points.size() < num_points * POINTS_PER_ENTRY) {
+        scratch_space.points.resize(num_points * POINTS_PER_ENTRY);
+    }
+    if (scratch_space.field_elements.size() < num_points) {
+        scratch_space.field_elements.resize(num_points);
+    }
+
+    detail::EndoScalars endo_scalars = Fr::split_into_endomorphism_scalars(converted_scalar);
+    detail::EndomorphismWnaf<element, NUM_ROUNDS> wnaf{ endo_scalars };
+    constexpr Fq beta = Fq::cube_root_of_unity();
+
+    run_loop_in_parallel_if_effective(
+        num_points,
+        [&](size_t start, size_t end) {
+            const size_t count = end - start;
+            affine_element* lookup_table = &scratch_space.points[start * POINTS_PER_ENTRY];
+            affine_element* to_add = lookup_table + LOOKUP_SIZE * count;
+            affine_element* work_elements = to_add + count;
+            Fq* field_scratch = &scratch_space.field_elements[start];
+
+            // Construct the lookup table of odd multiples. If the point is at infinity we fix-up the result later;
+            // to avoid 'trying to invert zero in the field' we set the point to 'one' here
+            for (size_t i = 0; i < count; ++i) {
+                const auto& point = points[start + i];
+                lookup_table[i] = point.is_point_at_infinity() ? affine_element::one() : point;
+                to_add[i] = lookup_table[i];
+            }
+            batch_affine_double_chunked(to_add, count, field_scratch);
+            for (size_t j = 1; j < LOOKUP_SIZE; ++j) {
+                std::copy(lookup_table + (j - 1) * count, lookup_table + j * count, lookup_table + j * count);
+                batch_affine_add_chunked(to_add, lookup_table + j * count, count, field_scratch);
+            }
+
+            const auto load_addends = [&](const size_t wnaf_index, affine_element* destination) {
+                const uint64_t wnaf_entry = wnaf.table[wnaf_index];
+                const auto index = static_cast<size_t>(wnaf_entry & 0x0fffffffU);
+                const bool is_odd = ((wnaf_index & 1) == 1);
+                const bool negate = static_cast<bool>((wnaf_entry >> 31) & 1) ^ is_odd;
+                const affine_element* row = lookup_table + index * count;
+                for (size_t i = 0; i < count; ++i) {
+                    destination[i] = row[i];
+                    destination[i].y.self_conditional_negate(negate);
+                    if (is_odd) {
+                        destination[i].x *= beta;
+                    }
+                }
+            };
+
+            // Run through SM logic in wnaf form (excluding the skew)
+            load_addends(0, work_elements);
+            load_addends(1, to_add);
+            batch_affine_add_chunked(to_add, work_elements, count, field_scratch);
+            for (size_t j = 2; j < NUM_ROUNDS * 2; ++j) {
+                if ((j & 1) == 0) {
+                    for (size_t k = 0; k < 4; ++k) {
+                        batch_affine_double_chunked(work_elements, count, field_scratch);
+                    }
+                }
+                load_addends(j, to_add);
+                batch_affine_add_chunked(to_add, work_elements, count, field_scratch);
+            }
+
+            // Apply skew for the first endo scalar
+            if (wnaf.skew) {
+                for (size_t i = 0; i < count; ++i) {
+                    to_add[i] = -lookup_table[i];
+                }
+                batch_affine_add_chunked(to_add, work_elements, count, field_scratch);
+            }
+            // Apply skew for the second endo scalar
+            if (wnaf.endo_skew) {
+                for (size_t i = 0; i < count; ++i) {
+                    to_add[i] = lookup_table[i];
+                    to_add[i].x *= beta;
+                }
+                batch_affine_add_chunked(to_add, work_elements, count, field_scratch);
+            }
+
+            // Add the products into the accumulators. Points at infinity and coincident x-coordinates can't go through
+            // the batched affine formula, in the (unlikely) event we encounter one the chunk falls back to projective
+            // arithmetic.
+            affine_element* chunk_accumulators = &accumulators[start];
+            bool has_edge_case = false;
+            for (size_t i = 0; i < count; ++i) {
+                has_edge_case = has_edge_case || points[start + i].is_point_at_infinity() ||
+                                chunk_accumulators[i].is_point_at_infinity() ||
+                                chunk_accumulators[i].x == work_elements[i].x;
+            }
+            if (!has_edge_case) {
+                batch_affine_add_chunked(work_elements, chunk_accumulators, count, field_scratch);
+                return;
+            }
+            for (size_t i = 0; i < count; ++i) {
+                if (points[start + i].is_point_at_infinity()) {
+                    continue;
+                }
+                chunk_accumulators[i] = affine_element(element(chunk_accumulators[i]) + element(work_elements[i]));
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        /*finite_field_multiplications_per_iteration=*/0,
+        /*finite_field_inversions_per_iteration=*/0,
+        /*group_element_additions_per_iteration=*/0,
+        /*group_element_doublings_per_iteration=*/0,
+        /*scalar_multiplications_per_iteration=*/1);
+}
+
 template <typename Fq, typename Fr, typename T>
 void element<Fq, Fr, T>::conditional_negate_affine(const affine_element<Fq, Fr, T>& in,
                                                    affine_element<Fq, Fr, T>& out,
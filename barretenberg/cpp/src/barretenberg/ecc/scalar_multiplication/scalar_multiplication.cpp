@@ -957,6 +957,60 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
     return pippenger(scalars, &G_mod[0], num_initial_points, state, false);
 }
 
+/**
+ * @brief Multi-scalar multiplication using Straus' interleaved window method
+ *
+ * @details Every point gets a table of its first 2^w multiples, the scalars are then processed in w-bit windows from
+ * the most significant end, with the w doublings per window shared between all points. For small numbers of points
+ * this avoids both the bucket bookkeeping of Pippenger and the per-point doublings of independent scalar
+ * multiplications, which makes it the method of choice for the small MSMs in the late rounds of the IPA prover.
+ *
+ * @param scalars
+ * @param points Plain affine points (i.e. not a Pippenger point table)
+ * @param num_points
+ */
+template <typename Curve>
+typename Curve::Element straus(const typename Curve::ScalarField* scalars,
+                               const typename Curve::AffineElement* points,
+                               const size_t num_points)
+{
+    using Element = typename Curve::Element;
+    constexpr size_t WINDOW_BITS = 4;
+    constexpr size_t TABLE_SIZE = 1UL << WINDOW_BITS;
+    constexpr size_t NUM_WINDOWS = (256 + WINDOW_BITS - 1) / WINDOW_BITS;
+
+    Element result = Curve::Group::point_at_infinity;
+    if (num_points == 0) {
+        return result;
+    }
+
+    std::vector<Element> tables(num_points * TABLE_SIZE);
+    std::vector<uint256_t> converted_scalars(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        Element* table = &tables[i * TABLE_SIZE];
+        table[0] = Curve::Group::point_at_infinity;
+        table[1] = Element(points[i]);
+        for (size_t j = 2; j < TABLE_SIZE; ++j) {
+            table[j] = table[j - 1] + table[1];
+        }
+        converted_scalars[i] = uint256_t(scalars[i]);
+    }
+
+    for (size_t window = NUM_WINDOWS - 1; window < NUM_WINDOWS; --window) {
+        for (size_t j = 0; j < WINDOW_BITS; ++j) {
+            result.self_dbl();
+        }
+        for (size_t i = 0; i < num_points; ++i) {
+            const auto digit = static_cast<size_t>(
+                converted_scalars[i].slice(window * WINDOW_BITS, (window + 1) * WINDOW_BITS).data[0]);
+            if (digit != 0) {
+                result += tables[i * TABLE_SIZE + digit];
+            }
+        }
+    }
+    return result;
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(curve::BN254::AffineElement* points,
@@ -1009,6 +1063,10 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     const size_t num_initial_points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template curve::BN254::Element straus<curve::BN254>(const curve::BN254::ScalarField* scalars,
+                                                    const curve::BN254::AffineElement* points,
+                                                    size_t num_points);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1060,6 +1118,10 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template curve::Grumpkin::Element straus<curve::Grumpkin>(const curve::Grumpkin::ScalarField* scalars,
+                                                          const curve::Grumpkin::AffineElement* points,
+                                                          size_t num_points);
+
 } // namespace bb::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
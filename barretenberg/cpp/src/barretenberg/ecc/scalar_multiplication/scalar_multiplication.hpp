@@ -170,6 +170,11 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
                                                                     size_t num_initial_points,
                                                                     pippenger_runtime_state<Curve>& state);
 
+template <typename Curve>
+typename Curve::Element straus(const typename Curve::ScalarField* scalars,
+                               const typename Curve::AffineElement* points,
+                               size_t num_points);
+
 // Explicit instantiation
 // BN254
 
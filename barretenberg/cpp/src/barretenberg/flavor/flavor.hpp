@@ -105,6 +105,7 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
     using FF = typename Polynomial::FF;
 
     size_t circuit_size;
+    size_t pub_inputs_offset = 0; // the row of the trace at which the public inputs are placed
     bool contains_recursive_proof;
     std::vector<uint32_t> recursive_proof_public_input_indices;
     bb::EvaluationDomain<FF> evaluation_domain;
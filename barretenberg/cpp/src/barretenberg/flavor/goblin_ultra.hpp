@@ -267,7 +267,7 @@ class GoblinUltraFlavor {
         std::vector<uint32_t> memory_read_records;
         std::vector<uint32_t> memory_write_records;
 
-        size_t num_ecc_op_gates; // needed to determine public input offset
+        size_t num_ecc_op_gates; // number of ecc op gates (rows), placed at the start of the trace
 
         auto get_to_be_shifted()
         {
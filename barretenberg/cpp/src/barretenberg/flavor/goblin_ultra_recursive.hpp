@@ -148,6 +148,28 @@ template <typename BuilderType> class GoblinUltraRecursiveFlavor_ {
             this->lagrange_ecc_op = Commitment::from_witness(builder, native_key->lagrange_ecc_op);
             this->databus_id = Commitment::from_witness(builder, native_key->databus_id);
         };
+
+        /**
+         * @brief Construct a Verification Key whose commitments are circuit constants rather than witnesses
+         *
+         * @details For use when the verified circuit is fixed at the time the recursive verifier circuit is built, e.g.
+         * a kernel that always verifies the same few circuits. Constant commitments need no bigfield witnesses, range
+         * constraints or on-curve checks. Build the key once per builder and hand it to each recursive verifier of that
+         * circuit.
+         *
+         * @param builder
+         * @param native_key Native verification key from which to extract the precomputed commitments
+         */
+        static std::shared_ptr<VerificationKey> from_constants(CircuitBuilder* builder,
+                                                               const std::shared_ptr<NativeVerificationKey>& native_key)
+        {
+            auto key = std::make_shared<VerificationKey>(native_key->circuit_size, native_key->num_public_inputs);
+            for (auto [commitment, native_commitment] : zip_view(key->get_all(), native_key->get_all())) {
+                commitment = Commitment(typename Curve::BaseField(builder, uint256_t(native_commitment.x)),
+                                        typename Curve::BaseField(builder, uint256_t(native_commitment.y)));
+            }
+            return key;
+        }
     };
 
     /**
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/timer.hpp"
 #include "barretenberg/eccvm/eccvm_composer.hpp"
 #include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/proof_system/circuit_builder/eccvm/eccvm_circuit_builder.hpp"
@@ -69,11 +71,46 @@ class Goblin {
         }
     };
 
+    /**
+     * @brief Number of cpus given to each of the proving stages that run concurrently in prove_concurrent
+     *
+     */
+    struct ConcurrencyBudget {
+        size_t eccvm_cpus = 1;
+        size_t translator_precompute_cpus = 1;
+
+        /**
+         * @brief Split the given cpus between the stages
+         * @details The ECCVM prover dominates the cost, the translator precomputation (lagrange polynomials, range
+         * constraint numerator and SRS points) is comparatively cheap and mostly memory bound, so it gets a quarter.
+         */
+        static ConcurrencyBudget split(const size_t num_cpus)
+        {
+            const size_t translator_precompute_cpus = std::max(num_cpus / 4, static_cast<size_t>(1));
+            const size_t eccvm_cpus = std::max(num_cpus - std::min(num_cpus, translator_precompute_cpus),
+                                               static_cast<size_t>(1));
+            return { eccvm_cpus, translator_precompute_cpus };
+        }
+    };
+
+    /**
+     * @brief Wall-clock time in milliseconds spent in each stage of the most recent call to prove_concurrent
+     *
+     */
+    struct StageTimings {
+        int64_t eccvm = 0;
+        int64_t translator_precompute = 0;
+        int64_t translator = 0;
+        int64_t total = 0;
+    };
+
     std::shared_ptr<OpQueue> op_queue = std::make_shared<OpQueue>();
 
     HonkProof merge_proof;
     Proof goblin_proof;
 
+    StageTimings stage_timings;
+
     // on the first call to accumulate there is no merge proof to verify
     bool merge_proof_exists{ false };
 
@@ -87,6 +124,18 @@ class Goblin {
 
     AccumulationOutput accumulator; // Used only for ACIR methods for now
 
+    /**
+     * @brief Construct the translator circuit from the ECCVM challenges and prove it with the current composer
+     *
+     */
+    void construct_translator_proof()
+    {
+        translator_builder = std::make_unique<TranslatorBuilder>(
+            eccvm_prover->translation_batching_challenge_v, eccvm_prover->evaluation_challenge_x, op_queue);
+        auto translator_prover = translator_composer->create_prover(*translator_builder, eccvm_prover->transcript);
+        goblin_proof.translator_proof = translator_prover.construct_proof();
+    }
+
   public:
     /**
      * @brief Construct a GUH proof and a merge proof for the present circuit.
@@ -164,11 +213,8 @@ class Goblin {
      */
     void prove_translator()
     {
-        translator_builder = std::make_unique<TranslatorBuilder>(
-            eccvm_prover->translation_batching_challenge_v, eccvm_prover->evaluation_challenge_x, op_queue);
         translator_composer = std::make_unique<TranslatorComposer>();
-        auto translator_prover = translator_composer->create_prover(*translator_builder, eccvm_prover->transcript);
-        goblin_proof.translator_proof = translator_prover.construct_proof();
+        construct_translator_proof();
     };
 
     /**
@@ -186,6 +232,64 @@ class Goblin {
         return goblin_proof;
     };
 
+    /**
+     * @brief Construct a full Goblin proof, overlapping independent proving stages
+     * @details Produces the same proof as prove(). The translator circuit can't be constructed before the ECCVM proof
+     * is complete since it depends on challenges generated at the end of it, but everything in the translator proving
+     * key that depends only on the circuit size (precomputed polynomials and the commitment key) can. That work runs
+     * concurrently with the ECCVM prover, each stage restricted to its own cpu budget so that neither oversubscribes
+     * the machine. The translator proof itself then runs with all cpus. Per-stage timings are recorded in
+     * stage_timings.
+     *
+     * @param budget The number of cpus given to each of the concurrent stages
+     * @return Proof
+     */
+    Proof prove_concurrent(const ConcurrencyBudget& budget = ConcurrencyBudget::split(get_num_cpus()))
+    {
+        BB_OP_COUNT_TIME_NAME("Goblin::prove_concurrent");
+        Timer total_timer;
+
+        goblin_proof.merge_proof = std::move(merge_proof);
+
+        translator_composer = std::make_unique<TranslatorComposer>();
+        const size_t translator_num_gates = TranslatorBuilder::compute_num_gates(op_queue->raw_ops.size());
+
+        run_tasks_concurrently({
+            { budget.eccvm_cpus,
+              [&]() {
+                  Timer timer;
+                  prove_eccvm();
+                  stage_timings.eccvm = timer.milliseconds();
+              } },
+            { budget.translator_precompute_cpus,
+              [&]() {
+                  Timer timer;
+                  translator_composer->precompute(translator_num_gates);
+                  stage_timings.translator_precompute = timer.milliseconds();
+              } },
+        });
+
+        Timer translator_timer;
+        construct_translator_proof();
+        stage_timings.translator = translator_timer.milliseconds();
+        stage_timings.total = total_timer.milliseconds();
+
+        debug("Goblin::prove_concurrent stage timings (ms): eccvm (",
+              budget.eccvm_cpus,
+              " cpus) ",
+              stage_timings.eccvm,
+              ", translator precompute (",
+              budget.translator_precompute_cpus,
+              " cpus) ",
+              stage_timings.translator_precompute,
+              ", translator ",
+              stage_timings.translator,
+              ", total ",
+              stage_timings.total);
+
+        return goblin_proof;
+    };
+
     /**
      * @brief Verify a full Goblin proof (ECCVM, Translator, merge)
      *
@@ -73,4 +73,31 @@ TEST_F(GoblinRecursionTests, Vanilla)
     EXPECT_TRUE(ultra_verified && verified);
 }
 
+/**
+ * @brief Check that the concurrent prover produces a valid proof identical to the one produced sequentially
+ *
+ */
+TEST_F(GoblinRecursionTests, ConcurrentProve)
+{
+    Goblin goblin;
+
+    // TODO(https://github.com/AztecProtocol/barretenberg/issues/723):
+    GoblinMockCircuits::perform_op_queue_interactions_for_mock_first_circuit(goblin.op_queue);
+
+    GoblinUltraCircuitBuilder function_circuit{ goblin.op_queue };
+    GoblinMockCircuits::construct_arithmetic_circuit(function_circuit, 1 << 8);
+    GoblinMockCircuits::construct_goblin_ecc_op_circuit(function_circuit);
+    goblin.merge(function_circuit);
+    HonkProof merge_proof = goblin.merge_proof;
+
+    Goblin::Proof sequential_proof = goblin.prove();
+
+    goblin.merge_proof = merge_proof;
+    Goblin::Proof concurrent_proof = goblin.prove_concurrent({ .eccvm_cpus = 2, .translator_precompute_cpus = 1 });
+
+    EXPECT_TRUE(goblin.verify(concurrent_proof));
+    EXPECT_EQ(sequential_proof.eccvm_proof, concurrent_proof.eccvm_proof);
+    EXPECT_EQ(sequential_proof.translator_proof, concurrent_proof.translator_proof);
+}
+
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/787) Expand these tests.
@@ -9,14 +9,15 @@
 namespace bb::plonk {
 
 /**
- * @brief Retrieve lagrange forms of selector polynomials and compute monomial and coset-monomial forms and put into
- * cache.
+ * @brief Retrieve lagrange forms of selector polynomials and compute monomial forms and put into cache.
+ * @details The coset evaluations used in quotient construction are computed by the prover, one quarter of the coset
+ * at a time.
  *
  * @param key Pointer to the proving key
  * @param selector_properties Names of selectors
  */
-void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_proving_key,
-                                               std::vector<SelectorProperties> selector_properties)
+void compute_monomial_selector_forms(plonk::proving_key* circuit_proving_key,
+                                     std::vector<SelectorProperties> selector_properties)
 {
     for (size_t i = 0; i < selector_properties.size(); i++) {
         // Compute monomial form of selector polynomial
@@ -26,14 +27,9 @@ void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_provi
         bb::polynomial_arithmetic::ifft(
             &selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
 
-        // Compute coset FFT of selector polynomial
-        bb::polynomial selector_poly_fft(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
-        selector_poly_fft.coset_fft(circuit_proving_key->large_domain);
-
         // Note: For Standard, the lagrange polynomials could be removed from the store at this point but this
         // is not the case for Ultra.
         circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_poly));
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft", std::move(selector_poly_fft));
     }
 }
 
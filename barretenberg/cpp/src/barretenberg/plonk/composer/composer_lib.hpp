@@ -29,14 +29,12 @@ void enforce_nonzero_selector_polynomials(const auto& circuit_constructor, auto*
 }
 
 /**
- * @brief Retrieve lagrange forms of selector polynomials and compute monomial and coset-monomial forms and put into
- * cache
+ * @brief Retrieve lagrange forms of selector polynomials and compute monomial forms and put into cache
  *
  * @param key Pointer to the proving key TODO(#293)
  * @param selector_properties Names of selectors
  */
-void compute_monomial_and_coset_selector_forms(plonk::proving_key* key,
-                                               std::vector<SelectorProperties> selector_properties);
+void compute_monomial_selector_forms(plonk::proving_key* key, std::vector<SelectorProperties> selector_properties);
 
 /**
  * @brief Computes the verification key by computing the:
@@ -46,7 +46,7 @@ std::shared_ptr<plonk::proving_key> StandardComposer::compute_proving_key(Circui
     // Make all selectors nonzero
     enforce_nonzero_selector_polynomials(circuit_constructor, circuit_proving_key.get());
     // Compute selectors in monomial form
-    compute_monomial_and_coset_selector_forms(circuit_proving_key.get(), standard_selector_properties());
+    compute_monomial_selector_forms(circuit_proving_key.get(), standard_selector_properties());
 
     circuit_proving_key->recursive_proof_public_input_indices =
         std::vector<uint32_t>(circuit_constructor.recursive_proof_public_input_indices.begin(),
@@ -32,6 +32,38 @@ TEST_F(StandardPlonkComposer, BaseCase)
     EXPECT_EQ(result, true);
 }
 
+/**
+ * @brief Check that batch verification accepts valid proofs for the same verification key, and rejects the batch as
+ * soon as it contains an invalid proof
+ */
+TEST_F(StandardPlonkComposer, BatchVerifyProofs)
+{
+    constexpr size_t num_valid_proofs = 3;
+    std::vector<plonk::proof> proofs;
+    std::optional<plonk::Verifier> verifier;
+    for (size_t i = 0; i < num_valid_proofs + 1; ++i) {
+        // Circuits of identical structure, the last one with a witness that does not satisfy the multiplication gate
+        auto builder = StandardCircuitBuilder();
+        auto composer = StandardComposer();
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        fr c = (i < num_valid_proofs) ? a * b : fr::random_element();
+        builder.create_mul_gate(
+            { builder.add_variable(a), builder.add_variable(b), builder.add_variable(c), fr::one(), fr::neg_one(), 0 });
+
+        auto prover = composer.create_prover(builder);
+        proofs.emplace_back(prover.construct_proof());
+        if (i == 0) {
+            verifier = composer.create_verifier(builder);
+        }
+    }
+
+    EXPECT_TRUE(verifier->batch_verify_proofs(std::span(proofs).first(num_valid_proofs)));
+    EXPECT_FALSE(verifier->batch_verify_proofs(proofs));
+    // The verifier can still be used to verify individual proofs afterwards
+    EXPECT_TRUE(verifier->verify_proof(proofs[0]));
+}
+
 TEST_F(StandardPlonkComposer, ComposerFromSerializedKeys)
 {
     auto builder = StandardCircuitBuilder();
@@ -170,17 +170,10 @@ std::shared_ptr<proving_key> UltraComposer::compute_proving_key(CircuitBuilder&
 
     enforce_nonzero_selector_polynomials(circuit, circuit_proving_key.get());
 
-    compute_monomial_and_coset_selector_forms(circuit_proving_key.get(), ultra_selector_properties());
+    compute_monomial_selector_forms(circuit_proving_key.get(), ultra_selector_properties());
 
     construct_table_polynomials(circuit, subgroup_size);
 
-    // Instantiate z_lookup and s polynomials in the proving key (no values assigned yet).
-    // Note: might be better to add these polys to cache only after they've been computed, as is convention
-    polynomial z_lookup_fft(subgroup_size * 4);
-    polynomial s_fft(subgroup_size * 4);
-    circuit_proving_key->polynomial_store.put("z_lookup_fft", std::move(z_lookup_fft));
-    circuit_proving_key->polynomial_store.put("s_fft", std::move(s_fft));
-
     circuit_proving_key->recursive_proof_public_input_indices = std::vector<uint32_t>(
         circuit.recursive_proof_public_input_indices.begin(), circuit.recursive_proof_public_input_indices.end());
 
@@ -191,6 +184,34 @@ std::shared_ptr<proving_key> UltraComposer::compute_proving_key(CircuitBuilder&
     return circuit_proving_key;
 }
 
+/**
+ * @brief Overwrite the witness-dependent polynomials of the proving key with the variables of the given circuit
+ *
+ * @details Only valid for a circuit whose gates are exactly those the key was computed from, with different variable
+ * values (see acir_format::replay_witness). Selectors, sigmas and table polynomials are kept; the wire polynomials
+ * and the sorted lookup polynomials are recomputed.
+ */
+void UltraComposer::update_witness(CircuitBuilder& circuit)
+{
+    ASSERT(circuit_proving_key && circuit.circuit_finalized);
+    const size_t subgroup_size = circuit_proving_key->circuit_size;
+
+    for (size_t wire_idx = 0; wire_idx < program_width; ++wire_idx) {
+        polynomial wire(subgroup_size);
+        size_t offset = 0;
+        for (auto& block : circuit.blocks.get()) {
+            const auto& block_wire = block.wires[wire_idx];
+            for (size_t row_idx = 0; row_idx < block_wire.size(); ++row_idx) {
+                wire[offset + row_idx] = circuit.get_variable(block_wire[row_idx]);
+            }
+            offset += block_wire.size();
+        }
+        circuit_proving_key->polynomial_store.put("w_" + std::to_string(wire_idx + 1) + "_lagrange", std::move(wire));
+    }
+
+    construct_sorted_polynomials(circuit, subgroup_size);
+}
+
 /**
  * Compute verification key consisting of selector precommitments.
  *
@@ -231,12 +252,8 @@ void UltraComposer::add_table_column_selector_poly_to_proving_key(polynomial& se
     selector_poly_lagrange_form.ifft(circuit_proving_key->small_domain);
     auto& selector_poly_coeff_form = selector_poly_lagrange_form;
 
-    polynomial selector_poly_coset_form(selector_poly_coeff_form, circuit_proving_key->circuit_size * 4);
-    selector_poly_coset_form.coset_fft(circuit_proving_key->large_domain);
-
     circuit_proving_key->polynomial_store.put(tag, std::move(selector_poly_coeff_form));
     circuit_proving_key->polynomial_store.put(tag + "_lagrange", std::move(selector_poly_lagrange_form_copy));
-    circuit_proving_key->polynomial_store.put(tag + "_fft", std::move(selector_poly_coset_form));
 }
 
 void UltraComposer::construct_table_polynomials(CircuitBuilder& circuit, size_t subgroup_size)
@@ -72,6 +72,7 @@ class UltraComposer {
 
     std::shared_ptr<plonk::proving_key> compute_proving_key(CircuitBuilder& circuit_constructor);
     std::shared_ptr<plonk::verification_key> compute_verification_key(CircuitBuilder& circuit_constructor);
+    void update_witness(CircuitBuilder& circuit_constructor);
 
     UltraProver create_prover(CircuitBuilder& circuit_constructor);
     UltraVerifier create_verifier(CircuitBuilder& circuit_constructor);
@@ -4,6 +4,7 @@
 
 #include "../types/program_settings.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/plonk/work_queue/work_queue.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -149,3 +150,56 @@ TEST(commitment_scheme, kate_batch_open)
         EXPECT_EQ(lhs, rhs);
     }
 }
+
+TEST(commitment_scheme, work_queue_mixed_items)
+{
+    // Commitments and IFFTs may be run concurrently by the work queue; the results must not depend on the schedule
+    size_t n = 256;
+    size_t num_commitments = 6;
+
+    transcript::StandardTranscript inp_tx = transcript::StandardTranscript(transcript::Manifest());
+    plonk::KateCommitmentScheme<ultra_settings> newKate;
+
+    auto file_crs = std::make_shared<bb::srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+    auto crs = file_crs->get_prover_crs(n);
+    auto circuit_proving_key = std::make_shared<proving_key>(n, 0, crs, CircuitType::STANDARD);
+    work_queue queue(circuit_proving_key.get(), &inp_tx);
+
+    polynomial lagrange(n);
+    for (size_t i = 0; i < n; ++i) {
+        lagrange[i] = fr::random_element();
+    }
+    polynomial expected_monomial(n);
+    polynomial_arithmetic::ifft(&lagrange[0], &expected_monomial[0], circuit_proving_key->small_domain);
+    circuit_proving_key->polynomial_store.put("w_1_lagrange", polynomial(lagrange));
+
+    std::vector<polynomial> polys;
+    for (size_t k = 0; k < num_commitments; ++k) {
+        polys.emplace_back(n);
+        for (size_t i = 0; i < n; ++i) {
+            polys[k][i] = fr::random_element();
+        }
+        newKate.commit(polys[k].data(), "F_" + std::to_string(k), n, queue);
+    }
+    queue.add_to_queue({
+        .work_type = work_queue::WorkType::IFFT,
+        .mul_scalars = nullptr,
+        .tag = "w_1",
+        .constant = 0,
+        .index = 0,
+    });
+    queue.process_queue();
+
+    EXPECT_EQ(circuit_proving_key->polynomial_store.get("w_1"), expected_monomial);
+
+    auto* srs_points = crs->get_monomial_points();
+    for (size_t k = 0; k < num_commitments; ++k) {
+        auto state = scalar_multiplication::pippenger_runtime_state<curve::BN254>(n);
+        g1::affine_element expected(scalar_multiplication::pippenger<curve::BN254>(&polys[k][0], srs_points, n, state));
+        EXPECT_EQ(inp_tx.get_element("F_" + std::to_string(k)), expected.to_buffer());
+    }
+
+    const auto& timings = queue.get_item_timings();
+    EXPECT_EQ(timings.size(), num_commitments + 1);
+    EXPECT_EQ(timings.back().work_type, work_queue::WorkType::IFFT);
+}
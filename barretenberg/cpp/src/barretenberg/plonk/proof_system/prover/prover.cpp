@@ -324,7 +324,6 @@ template <typename settings> void ProverBase<settings>::execute_second_round()
  * Execute third round:
  * - Apply Fiat-Shamir transform on the "beta" challenge
  * - Apply 3rd round random widgets*
- * - FFT the wires.
  *
  * *For example, standard composer executes permutation widget for z polynomial construction at this round.
  *
@@ -339,21 +338,14 @@ template <typename settings> void ProverBase<settings>::execute_third_round()
     for (auto& widget : random_widgets) {
         widget->compute_round_commitments(transcript, 3, queue);
     }
-
-    for (size_t i = 0; i < settings::program_width; ++i) {
-        std::string wire_tag = "w_" + std::to_string(i + 1);
-        queue.add_to_queue({
-            .work_type = work_queue::WorkType::FFT,
-            .mul_scalars = nullptr,
-            .tag = wire_tag,
-            .constant = bb::fr(0),
-            .index = 0,
-        });
-    }
 }
 
 /**
  * @brief Computes the quotient polynomial, then commits to its degree-n split parts.
+ *
+ * @details The quotient is evaluated on the 4n coset one quarter at a time (see compute_coset_quarter_forms), so the
+ * widgets only ever read n evaluations of each polynomial. Every quarter writes a disjoint set of entries of the
+ * quotient parts, and the widgets are run on it with the same powers of alpha.
  */
 template <typename settings> void ProverBase<settings>::execute_fourth_round()
 {
@@ -361,15 +353,23 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
     transcript.apply_fiat_shamir("alpha");
     fr alpha_base = fr::serialize_from_buffer(transcript.get_challenge("alpha").begin());
 
-    // Compute FFT of lagrange polynomial L_1 (needed in random widgets only)
-    compute_lagrange_1_fft();
-
-    for (auto& widget : random_widgets) {
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
+    // The coset evaluations are computed from the monomial form of every polynomial in the manifest. Start loading any
+    // that have been spilled from memory while we do the remaining setup.
+    for (const auto& descriptor : key->polynomial_manifest.get()) {
+        key->polynomial_store.prefetch(std::string(descriptor.polynomial_label));
     }
 
-    for (auto& widget : transition_widgets) {
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
+    for (size_t quarter = 0; quarter < 4; ++quarter) {
+        compute_coset_quarter_forms(quarter);
+
+        fr alpha = alpha_base;
+        for (auto& widget : random_widgets) {
+            alpha = widget->compute_quotient_contribution(alpha, transcript, quarter);
+        }
+
+        for (auto& widget : transition_widgets) {
+            alpha = widget->compute_quotient_contribution(alpha, transcript, quarter);
+        }
     }
 
     // The parts of the quotient polynomial t(X) are stored as 4 separate polynomials in
@@ -403,6 +403,10 @@ template <typename settings> void ProverBase<settings>::execute_fifth_round()
 {
     queue.flush_queue();
     transcript.apply_fiat_shamir("z"); // end of 4th round
+    // The evaluations at z and the batch opening read the monomial form of every polynomial in the manifest.
+    for (const auto& descriptor : key->polynomial_manifest.get()) {
+        key->polynomial_store.prefetch(std::string(descriptor.polynomial_label));
+    }
 #ifdef DEBUG_TIMING
     std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 #endif
@@ -474,15 +478,28 @@ template <typename settings> void ProverBase<settings>::add_blinding_to_quotient
     }
 }
 
-// Compute FFT of lagrange polynomial L_1 needed in random widgets only
-template <typename settings> void ProverBase<settings>::compute_lagrange_1_fft()
+/**
+ * @brief Computes the evaluations of every polynomial in the manifest, and of L_1, on one quarter of the 4n coset.
+ *
+ * @details Entry 4i + q of the 4n coset FFT is the evaluation at g.(ω')^q.ω^i, where ω' is the 4n'th root of unity. So
+ * quarter q is the coset g.(ω')^q.H of the small domain, and its evaluations are an n-sized coset FFT of the monomial
+ * form with generator shift (ω')^q. On a quarter, X -> X.ω is a shift by one.
+ *
+ * The evaluations are stored under "<label>_fft" and "lagrange_1_fft", and replace those of the previous quarter.
+ */
+template <typename settings> void ProverBase<settings>::compute_coset_quarter_forms(const size_t quarter)
 {
-    polynomial lagrange_1_fft(4 * circuit_size + 8);
-    polynomial_arithmetic::compute_lagrange_polynomial_fft(
-        lagrange_1_fft.data().get(), key->small_domain, key->large_domain);
-    for (size_t i = 0; i < 8; i++) {
-        lagrange_1_fft[4 * circuit_size + i] = lagrange_1_fft[i];
+    const fr generator_shift = key->large_domain.root.pow(static_cast<uint64_t>(quarter));
+    for (const auto& descriptor : key->polynomial_manifest.get()) {
+        const std::string label(descriptor.polynomial_label);
+        polynomial coset_form(key->polynomial_store.get(label), circuit_size);
+        coset_form.coset_fft_with_generator_shift(key->small_domain, generator_shift);
+        key->polynomial_store.put(label + "_fft", std::move(coset_form));
     }
+
+    polynomial lagrange_1_fft(circuit_size);
+    polynomial_arithmetic::compute_lagrange_polynomial_fft_slice(
+        lagrange_1_fft.data().get(), key->small_domain, key->large_domain, quarter);
     key->polynomial_store.put("lagrange_1_fft", std::move(lagrange_1_fft));
 }
 
@@ -494,6 +511,9 @@ template <typename settings> plonk::proof& ProverBase<settings>::export_proof()
 
 template <typename settings> plonk::proof& ProverBase<settings>::construct_proof()
 {
+    // Item timings cover a single proof.
+    queue.clear_item_timings();
+
     // Execute init round. Randomize witness polynomials.
     // info("preamble");
     execute_preamble_round();
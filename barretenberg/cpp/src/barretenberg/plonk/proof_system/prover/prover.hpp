@@ -37,7 +37,7 @@ template <typename settings> class ProverBase {
 
     void compute_quotient_evaluation();
     void add_blinding_to_quotient_polynomial_parts();
-    void compute_lagrange_1_fft();
+    void compute_coset_quarter_forms(size_t quarter);
     plonk::proof& export_proof();
     plonk::proof& construct_proof();
 
@@ -203,23 +203,11 @@ plonk::Prover generate_test_data(const size_t n)
     sigma_1.ifft(key->small_domain);
     sigma_2.ifft(key->small_domain);
     sigma_3.ifft(key->small_domain);
-    constexpr size_t width = 4;
-    polynomial sigma_1_fft(sigma_1, key->circuit_size * width);
-    polynomial sigma_2_fft(sigma_2, key->circuit_size * width);
-    polynomial sigma_3_fft(sigma_3, key->circuit_size * width);
-
-    sigma_1_fft.coset_fft(key->large_domain);
-    sigma_2_fft.coset_fft(key->large_domain);
-    sigma_3_fft.coset_fft(key->large_domain);
 
     key->polynomial_store.put("sigma_1", std::move(sigma_1));
     key->polynomial_store.put("sigma_2", std::move(sigma_2));
     key->polynomial_store.put("sigma_3", std::move(sigma_3));
 
-    key->polynomial_store.put("sigma_1_fft", std::move(sigma_1_fft));
-    key->polynomial_store.put("sigma_2_fft", std::move(sigma_2_fft));
-    key->polynomial_store.put("sigma_3_fft", std::move(sigma_3_fft));
-
     w_l.at(n - 1) = fr::zero();
     w_r.at(n - 1) = fr::zero();
     w_o.at(n - 1) = fr::zero();
@@ -244,30 +232,12 @@ plonk::Prover generate_test_data(const size_t n)
     q_m.ifft(key->small_domain);
     q_c.ifft(key->small_domain);
 
-    polynomial q_1_fft(q_l, n * 4);
-    polynomial q_2_fft(q_r, n * 4);
-    polynomial q_3_fft(q_o, n * 4);
-    polynomial q_m_fft(q_m, n * 4);
-    polynomial q_c_fft(q_c, n * 4);
-
-    q_1_fft.coset_fft(key->large_domain);
-    q_2_fft.coset_fft(key->large_domain);
-    q_3_fft.coset_fft(key->large_domain);
-    q_m_fft.coset_fft(key->large_domain);
-    q_c_fft.coset_fft(key->large_domain);
-
     key->polynomial_store.put("q_1", std::move(q_l));
     key->polynomial_store.put("q_2", std::move(q_r));
     key->polynomial_store.put("q_3", std::move(q_o));
     key->polynomial_store.put("q_m", std::move(q_m));
     key->polynomial_store.put("q_c", std::move(q_c));
 
-    key->polynomial_store.put("q_1_fft", std::move(q_1_fft));
-    key->polynomial_store.put("q_2_fft", std::move(q_2_fft));
-    key->polynomial_store.put("q_3_fft", std::move(q_3_fft));
-    key->polynomial_store.put("q_m_fft", std::move(q_m_fft));
-    key->polynomial_store.put("q_c_fft", std::move(q_c_fft));
-
     std::unique_ptr<plonk::ProverPermutationWidget<3, false>> permutation_widget =
         std::make_unique<plonk::ProverPermutationWidget<3, false>>(key.get());
 
@@ -53,7 +53,7 @@ proving_key::proving_key(proving_key_data&& data,
     , recursive_proof_public_input_indices(std::move(data.recursive_proof_public_input_indices))
     , memory_read_records(data.memory_read_records)
     , memory_write_records(data.memory_write_records)
-    , polynomial_store(data.polynomial_store)
+    , polynomial_store(std::move(data.polynomial_store))
     , small_domain(circuit_size, circuit_size)
     , large_domain(4 * circuit_size, circuit_size > min_thread_block ? circuit_size : 4 * circuit_size)
     , reference_string(crs)
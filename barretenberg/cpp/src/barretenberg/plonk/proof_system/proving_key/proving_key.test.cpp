@@ -156,3 +156,22 @@ StandardComposer(); fr a = fr::one(); builder.add_public_variable(a);
 }
 #endif
 */
+
+// Test that a serialized proving key without the format header (i.e. written before the key format was versioned) is
+// rejected rather than misread
+TEST(proving_key, serialized_key_without_format_version_is_rejected)
+{
+    auto builder = StandardCircuitBuilder();
+    auto composer = StandardComposer();
+    fr a = fr::one();
+    builder.add_public_variable(a);
+
+    plonk::proving_key& p_key = *composer.compute_proving_key(builder);
+    auto pk_buf = to_buffer(p_key);
+    const std::vector<uint8_t> unversioned_buf(pk_buf.begin() + 2 * sizeof(uint32_t), pk_buf.end());
+    EXPECT_ANY_THROW(from_buffer<plonk::proving_key_data>(unversioned_buf));
+
+    // Same for a key with an unknown version
+    pk_buf[2 * sizeof(uint32_t) - 1] ^= 0xff;
+    EXPECT_ANY_THROW(from_buffer<plonk::proving_key_data>(pk_buf));
+}
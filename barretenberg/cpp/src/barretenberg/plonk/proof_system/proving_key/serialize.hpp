@@ -10,12 +10,46 @@
 
 namespace bb::plonk {
 
+// Serialized proving keys start with a magic number and a format version, so that a key written in another layout is
+// rejected instead of misread. Keys from before versioning start with the circuit type, which never equals the magic.
+// Version 2: the coset FFT ("_fft") forms of the selector, permutation and table polynomials are no longer stored;
+// the prover computes them per proof, one coset quarter at a time.
+constexpr uint32_t PROVING_KEY_MAGIC = 0x706b6579; // "pkey"
+constexpr uint32_t PROVING_KEY_FORMAT_VERSION = 2;
+
+template <typename B> inline void read_proving_key_format(B& any)
+{
+    using serialize::read;
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    read(any, magic);
+    if (magic != PROVING_KEY_MAGIC) {
+        throw_or_abort("Proving key has no format version, it was written by an older version and must be regenerated");
+    }
+    read(any, version);
+    if (version != PROVING_KEY_FORMAT_VERSION) {
+        throw_or_abort(format("Proving key format version ",
+                              version,
+                              " is not supported (expected ",
+                              PROVING_KEY_FORMAT_VERSION,
+                              "), the key must be regenerated"));
+    }
+}
+
+template <typename B> inline void write_proving_key_format(B& buf)
+{
+    using serialize::write;
+    write(buf, PROVING_KEY_MAGIC);
+    write(buf, PROVING_KEY_FORMAT_VERSION);
+}
+
 // Read the pre-computed polynomials
 template <typename B> inline void read(B& any, proving_key_data& key)
 {
     using serialize::read;
     using std::read;
 
+    read_proving_key_format(any);
     read(any, static_cast<uint32_t&>(key.circuit_type));
     read(any, static_cast<uint32_t&>(key.circuit_size));
     read(any, static_cast<uint32_t&>(key.num_public_inputs));
@@ -43,6 +77,7 @@ template <typename B> inline void read(B& any, proving_key_data& key)
 template <typename B> inline void write(B& buf, proving_key const& key)
 {
     using serialize::write;
+    write_proving_key_format(buf);
     write(buf, static_cast<uint32_t>(key.circuit_type));
     write(buf, static_cast<uint32_t>(key.circuit_size));
     write(buf, static_cast<uint32_t>(key.num_public_inputs));
@@ -70,6 +105,7 @@ template <typename B> inline void read_from_file(B& is, std::string const& path,
     using serialize::read;
 
     size_t file_num = 0;
+    read_proving_key_format(is);
     read(is, key.circuit_type);
     read(is, key.circuit_size);
     read(is, key.num_public_inputs);
@@ -111,6 +147,7 @@ template <typename B> inline void write_to_file(B& os, std::string const& path,
     using serialize::write;
 
     size_t file_num = 0;
+    write_proving_key_format(os);
     write(os, static_cast<uint32_t>(key.circuit_type));
     write(os, static_cast<uint32_t>(key.circuit_size));
     write(os, static_cast<uint32_t>(key.num_public_inputs));
@@ -179,9 +179,8 @@ class PolynomialManifest {
 // This class constructs and provides access to a full list of pre-computed
 // polynomial IDs based on the composer type. This is used, for example, for
 // serialization of the pre-computed portion of the proving key. The list is
-// comprised of IDs corresponding to: the selector polynomials (monomial and
-// coset fft forms) and the permutation polynomials (monomial, coset fft and
-// lagrange forms).
+// comprised of IDs corresponding to: the selector polynomials (monomial form)
+// and the permutation polynomials (monomial and lagrange forms).
 class PrecomputedPolyList {
 
   private:
@@ -200,17 +199,15 @@ class PrecomputedPolyList {
             switch (source) {
             case PolynomialSource::WITNESS: // no witness polys are precomputed
                 break;
-            case PolynomialSource::SELECTOR: // monomial and fft
+            case PolynomialSource::SELECTOR: // monomial
                 precomputed_poly_ids.emplace_back(label);
-                precomputed_poly_ids.emplace_back(label + "_fft");
                 // Store all lagrange forms of selector polynomials for ultra
                 if (circuit_type == CircuitType::ULTRA) {
                     precomputed_poly_ids.emplace_back(label + "_lagrange");
                 }
                 break;
-            case PolynomialSource::PERMUTATION: // monomial, fft, and lagrange
+            case PolynomialSource::PERMUTATION: // monomial and lagrange
                 precomputed_poly_ids.emplace_back(label);
-                precomputed_poly_ids.emplace_back(label + "_fft");
                 precomputed_poly_ids.emplace_back(label + "_lagrange");
                 break;
             case PolynomialSource::OTHER:
@@ -2,6 +2,7 @@
 #include "../public_inputs/public_inputs.hpp"
 #include "../utils/kate_verification.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/commitment_schemes/verification_key.hpp"
 #include "barretenberg/ecc/curves/bn254/fq12.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
@@ -36,7 +37,13 @@ VerifierBase<program_settings>& VerifierBase<program_settings>::operator=(Verifi
     return *this;
 }
 
-template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+/**
+ * @brief Run the verifier on a proof up to the final pairing check
+ *
+ * @return The points P_0, P_1 such that the proof is valid iff e(P_0, [1]_2).e(P_1, [x]_2) == 1
+ */
+template <typename program_settings>
+std::array<g1::element, 2> VerifierBase<program_settings>::compute_pairing_points(const plonk::proof& proof)
 {
     // This function verifies a PLONK proof for given program settings.
     // A PLONK proof for standard PLONK is of the form:
@@ -49,6 +56,10 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
 
     key->program_width = program_settings::program_width;
 
+    // The verifier may be reused for several proofs, so discard the scalars and group elements of any previous proof
+    kate_g1_elements.clear();
+    kate_fr_elements.clear();
+
     // Add the proof data to the transcript, according to the manifest. Also initialize the transcript's hash type and
     // challenge bytes.
     transcript::StandardTranscript transcript = transcript::StandardTranscript(
@@ -179,7 +190,7 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     bb::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(&elements[0], &elements[0], num_elements);
     scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
 
-    g1::element P[2];
+    std::array<g1::element, 2> P;
 
     P[0] = bb::scalar_multiplication::pippenger<curve::BN254>(&scalars[0], &elements[0], num_elements, state);
     P[1] = -(g1::element(PI_Z_OMEGA) * separator_challenge + PI_Z);
@@ -223,7 +234,14 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
         P[1] += g1::element(x1, y1, 1) * recursion_separator_challenge;
     }
 
-    g1::element::batch_normalize(P, 2);
+    return P;
+}
+
+template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+{
+    std::array<g1::element, 2> P = compute_pairing_points(proof);
+
+    g1::element::batch_normalize(P.data(), 2);
 
     g1::affine_element P_affine[2]{
         { P[0].x, P[0].y },
@@ -237,6 +255,52 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     return (result == bb::fq12::one());
 }
 
+/**
+ * @brief Verify several proofs for the verification key of this verifier with a single pairing check
+ * @details Every proof i is reduced to its pairing points P_0^i, P_1^i. Since all proofs share the G2 points [1]_2 and
+ * [x]_2, the checks e(P_0^i, [1]_2).e(P_1^i, [x]_2) == 1 are combined with random weights r_i into the single check
+ * e(\sum_i r_i.P_0^i, [1]_2).e(\sum_i r_i.P_1^i, [x]_2) == 1, which costs two Miller loops and one final
+ * exponentiation irrespective of the number of proofs. A batch containing an invalid proof passes with negligible
+ * probability. The weighted combination is shared with Honk, see VerifierCommitmentKey::batch_pairing_points. The
+ * proofs are reduced sequentially, as the reduction mutates the state of the verifier and the key.
+ */
+template <typename program_settings>
+bool VerifierBase<program_settings>::batch_verify_proofs(std::span<const plonk::proof> proofs)
+{
+    if (proofs.empty()) {
+        return true;
+    }
+    const size_t num_proofs = proofs.size();
+
+    std::vector<g1::element> points(2 * num_proofs);
+    for (size_t i = 0; i < num_proofs; ++i) {
+        const auto [P_0, P_1] = compute_pairing_points(proofs[i]);
+        points[2 * i] = P_0;
+        points[2 * i + 1] = P_1;
+    }
+    g1::element::batch_normalize(points.data(), points.size());
+
+    // The points are normalized, so their affine coordinates (and infinity flag) can be read off directly
+    std::vector<std::array<g1::affine_element, 2>> pairing_points(num_proofs);
+    for (size_t i = 0; i < num_proofs; ++i) {
+        pairing_points[i] = { g1::affine_element{ points[2 * i].x, points[2 * i].y },
+                              g1::affine_element{ points[2 * i + 1].x, points[2 * i + 1].y } };
+    }
+
+    std::array<g1::element, 2> P = VerifierCommitmentKey<curve::BN254>::batch_pairing_points(pairing_points);
+    g1::element::batch_normalize(P.data(), 2);
+
+    g1::affine_element P_affine[2]{
+        { P[0].x, P[0].y },
+        { P[1].x, P[1].y },
+    };
+
+    bb::fq12 result = bb::pairing::reduced_ate_pairing_batch_precomputed(
+        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
+
+    return (result == bb::fq12::one());
+}
+
 template class VerifierBase<standard_verifier_settings>;
 template class VerifierBase<ultra_verifier_settings>;
 template class VerifierBase<ultra_to_standard_verifier_settings>;
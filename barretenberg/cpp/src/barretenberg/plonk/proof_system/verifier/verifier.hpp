@@ -19,7 +19,9 @@ template <typename program_settings> class VerifierBase {
     bool validate_commitments();
     bool validate_scalars();
 
+    std::array<g1::element, 2> compute_pairing_points(const plonk::proof& proof);
     bool verify_proof(const plonk::proof& proof);
+    bool batch_verify_proofs(std::span<const plonk::proof> proofs);
     transcript::Manifest manifest;
 
     std::shared_ptr<verification_key> key;
@@ -35,7 +35,8 @@ class ProverPermutationWidget : public ProverRandomWidget {
                                    work_queue& queue) override;
 
     bb::fr compute_quotient_contribution(const bb::fr& alpha_base,
-                                         const transcript::StandardTranscript& transcript) override;
+                                         const transcript::StandardTranscript& transcript,
+                                         const size_t quarter) override;
 };
 
 } // namespace bb::plonk
@@ -324,21 +324,14 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
         0,
     });
 
-    // Compute coset-form of z:
-    queue.add_to_queue({
-        work_queue::WorkType::FFT,
-        nullptr,
-        "z_perm",
-        bb::fr(0),
-        0,
-    });
-
     key->polynomial_store.put("z_perm", std::move(z_perm));
 }
 
 template <size_t program_width, bool idpolys, const size_t num_roots_cut_out_of_vanishing_polynomial>
 bb::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanishing_polynomial>::
-    compute_quotient_contribution(const fr& alpha_base, const transcript::StandardTranscript& transcript)
+    compute_quotient_contribution(const fr& alpha_base,
+                                  const transcript::StandardTranscript& transcript,
+                                  const size_t quarter)
 {
     const polynomial& z_perm_fft = key->polynomial_store.get("z_perm_fft");
 
@@ -348,9 +341,11 @@ bb::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vani
 
     // Initialize the (n + 1)th coefficients of quotient parts so that reuse of proving
     // keys does not use some residual data from another proof.
-    key->quotient_polynomial_parts[0][key->circuit_size] = 0;
-    key->quotient_polynomial_parts[1][key->circuit_size] = 0;
-    key->quotient_polynomial_parts[2][key->circuit_size] = 0;
+    if (quarter == 0) {
+        key->quotient_polynomial_parts[0][key->circuit_size] = 0;
+        key->quotient_polynomial_parts[1][key->circuit_size] = 0;
+        key->quotient_polynomial_parts[2][key->circuit_size] = 0;
+    }
 
     // Our permutation check boils down to two 'grand product' arguments, that we represent with a single polynomial
     // z(X). We want to test that z(X) has been constructed correctly. When evaluated at elements of ω ∈ H, the
@@ -403,19 +398,23 @@ bb::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vani
 
     bb::fr public_input_delta = compute_public_input_delta<fr>(public_inputs, beta, gamma, key->small_domain.root);
 
-    const size_t block_mask = key->large_domain.size - 1;
+    // The "_fft" forms hold the evaluations on quarter `quarter` of the 4n coset, i.e. at the points
+    // g.(ω')^{quarter}.ω^i, where ω' is the 4n'th root of unity. Point i is entry 4i + quarter of the full coset.
+    const size_t block_mask = key->small_domain.size - 1;
+    const bb::fr quarter_shift = key->large_domain.root.pow(static_cast<uint64_t>(quarter));
     // Step 4: Set the quotient polynomial to be equal to
-    parallel_for(key->large_domain.num_threads, [&](size_t j) {
-        const size_t start = j * key->large_domain.thread_size;
-        const size_t end = (j + 1) * key->large_domain.thread_size;
+    parallel_for(key->small_domain.num_threads, [&](size_t j) {
+        const size_t start = j * key->small_domain.thread_size;
+        const size_t end = (j + 1) * key->small_domain.thread_size;
 
         // Leverage multi-threading by computing quotient polynomial at points
-        // (ω^{j * num_threads}, ω^{j * num_threads + 1}, ..., ω^{j * num_threads + num_threads})
+        // (ω^{j * num_threads}, ω^{j * num_threads + 1}, ..., ω^{j * num_threads + num_threads}) of the quarter
         //
-        // curr_root = ω^{j * num_threads} * g_{small} * β
+        // curr_root = ω^{j * num_threads} * (ω')^{quarter} * g_{small} * β
         // curr_root will be used in denominator
         bb::fr cur_root_times_beta =
-            key->large_domain.root.pow(static_cast<uint64_t>(j * key->large_domain.thread_size));
+            key->small_domain.root.pow(static_cast<uint64_t>(j * key->small_domain.thread_size));
+        cur_root_times_beta *= quarter_shift;
         cur_root_times_beta *= key->small_domain.generator;
         cur_root_times_beta *= beta;
 
@@ -457,7 +456,7 @@ bb::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vani
             }
 
             numerator *= z_perm_fft[i];
-            denominator *= z_perm_fft[(i + 4) & block_mask];
+            denominator *= z_perm_fft[(i + 1) & block_mask];
 
             /**
              * Permutation bounds check
@@ -493,9 +492,9 @@ bb::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vani
             // this
 
             // z_perm_fft already contains evaluations of Z(X).(\alpha^2)
-            // at the (4n)'th roots of unity
-            // => to get Z(X.w) instead of Z(X), index element (i+4) instead of i
-            T0 = z_perm_fft[(i + 4) & block_mask] - public_input_delta; // T0 = (Z(X.w) - (delta)).(\alpha^2)
+            // at the points of the quarter
+            // => to get Z(X.w) instead of Z(X), index element (i+1) instead of i
+            T0 = z_perm_fft[(i + 1) & block_mask] - public_input_delta; // T0 = (Z(X.w) - (delta)).(\alpha^2)
             T0 *= alpha_base;                                           // T0 = (Z(X.w) - (delta)).(\alpha^3)
 
             // T0 = (z(X.ω) - Δ).(α^3).L_{end}
@@ -503,11 +502,10 @@ bb::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vani
             //
             // Note that L_j(X) = L_1(X . ω^{-j}) = L_1(X . ω^{n-j})
             // => L_{end}= L_1(X . ω^{num_roots_cut_out_of_vanishing_polynomial + 1})
-            // => fetch the value at index (i + (num_roots_cut_out_of_vanishing_polynomial + 1) * 4) in l_1
-            // the factor of 4 is because l_1 is a 4n-size fft.
+            // => fetch the value at index (i + num_roots_cut_out_of_vanishing_polynomial + 1) in l_1
             //
             // Recall, we use l_start for l_1 for consistency in notation.
-            T0 *= l_start[(i + 4 + 4 * num_roots_cut_out_of_vanishing_polynomial) & block_mask];
+            T0 *= l_start[(i + 1 + num_roots_cut_out_of_vanishing_polynomial) & block_mask];
             numerator += T0;
 
             // Step 2: Compute (z(X) - 1).(α^4).L1(X)
@@ -522,11 +520,12 @@ bb::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vani
 
             // Combine into quotient polynomial
             T0 = numerator - denominator;
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)] =
-                T0 * alpha_base;
+            const size_t coset_index = 4 * i + quarter;
+            key->quotient_polynomial_parts[coset_index >> key->small_domain.log2_size]
+                                          [coset_index & (key->circuit_size - 1)] = T0 * alpha_base;
 
             // Update our working root of unity
-            cur_root_times_beta *= key->large_domain.root;
+            cur_root_times_beta *= key->small_domain.root;
         }
     });
     return alpha_base.sqr().sqr();
@@ -333,7 +333,7 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_gra
 }
 
 /**
- * @brief Compute commitments and FFTs of 's' (round_number == 2) or 'Z_lookup' (round_number == 3)
+ * @brief Compute commitments of 's' (round_number == 2) or 'Z_lookup' (round_number == 3)
  *
  * @tparam num_roots_cut_out_of_vanishing_polynomial
  * @param transcript
@@ -357,15 +357,6 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_rou
             .index = 0,
         });
 
-        // Compute the coset FFT of 's' for use in quotient poly construction
-        queue.add_to_queue({
-            .work_type = work_queue::WorkType::FFT,
-            .mul_scalars = nullptr,
-            .tag = "s",
-            .constant = bb::fr(0),
-            .index = 0,
-        });
-
         return;
     }
     if (round_number == 3) {
@@ -381,15 +372,6 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_rou
             .index = 0,
         });
 
-        // Compute the coset FFT of 'z_lookup' for use in quotient poly construction
-        queue.add_to_queue({
-            .work_type = work_queue::WorkType::FFT,
-            .mul_scalars = nullptr,
-            .tag = "z_lookup",
-            .constant = bb::fr(0),
-            .index = 0,
-        });
-
         return;
     }
 }
@@ -400,6 +382,7 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_rou
  * @tparam num_roots_cut_out_of_vanishing_polynomial
  * @param alpha_base
  * @param transcript
+ * @param quarter The quarter of the 4n coset whose evaluations are in the "_fft" forms
  * @return bb::fr
  *
  * @details The terms associated with the z_lookup grand product polynomial that must be added
@@ -413,12 +396,12 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_rou
  * associated with the Standard Plonk grand product polynomial Z that also appear in the quotient
  * polynomial. See the comments there for more details. The contribution of these terms is
  * incorporated into the quotient polynomial via the coset evaluation form (i.e. the evaluation
- * on 4nth roots of unity).
+ * on 4nth roots of unity), one quarter of the coset at a time.
  *
  */
 template <const size_t num_roots_cut_out_of_vanishing_polynomial>
 bb::fr ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_quotient_contribution(
-    const fr& alpha_base, const transcript::StandardTranscript& transcript)
+    const fr& alpha_base, const transcript::StandardTranscript& transcript, const size_t quarter)
 {
     auto z_lookup_fft = key->polynomial_store.get("z_lookup_fft");
 
@@ -465,40 +448,38 @@ bb::fr ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_q
 
     const fr beta_constant = beta + fr(1); // (1 + β)
 
-    const size_t block_mask = key->large_domain.size - 1;
+    // On a quarter of the coset, X -> X.ω is a shift by one.
+    const size_t block_mask = key->small_domain.size - 1;
 
     // Add to the quotient polynomial the components associated with z_lookup
-    parallel_for(key->large_domain.num_threads, [&](size_t j) {
-        const size_t start = j * key->large_domain.thread_size;
-        const size_t end = (j + 1) * key->large_domain.thread_size;
+    parallel_for(key->small_domain.num_threads, [&](size_t j) {
+        const size_t start = j * key->small_domain.thread_size;
+        const size_t end = (j + 1) * key->small_domain.thread_size;
 
         fr T0;
         fr T1;
         fr denominator;
         fr numerator;
 
-        // Initialize first four t(X) = t_table(X) for expression t + βt(Xω) + γ(1 + β)
-        std::array<fr, 4> next_ts;
-        for (size_t i = 0; i < 4; ++i) {
-            next_ts[i] = table_ffts[3][(start + i) & block_mask];
-            next_ts[i] *= eta;
-            next_ts[i] += table_ffts[2][(start + i) & block_mask];
-            next_ts[i] *= eta;
-            next_ts[i] += table_ffts[1][(start + i) & block_mask];
-            next_ts[i] *= eta;
-            next_ts[i] += table_ffts[0][(start + i) & block_mask];
-        }
+        // Initialize t(X) = t_table(X) for expression t + βt(Xω) + γ(1 + β)
+        fr next_t = table_ffts[3][start];
+        next_t *= eta;
+        next_t += table_ffts[2][start];
+        next_t *= eta;
+        next_t += table_ffts[1][start];
+        next_t *= eta;
+        next_t += table_ffts[0][start];
         for (size_t i = start; i < end; ++i) {
             // Set T0 = f := (w_1 + q_2*w_1(Xω)) + η(w_2 + q_m*w_2(Xω)) + η²(w_3 + q_c*w_3(Xω)) + η³q_index
             T0 = lookup_index_fft[i];
             T0 *= eta;
-            T0 += wire_ffts[2][(i + 4) & block_mask] * column_3_step_size[i];
+            T0 += wire_ffts[2][(i + 1) & block_mask] * column_3_step_size[i];
             T0 += wire_ffts[2][i];
             T0 *= eta;
-            T0 += wire_ffts[1][(i + 4) & block_mask] * column_2_step_size[i];
+            T0 += wire_ffts[1][(i + 1) & block_mask] * column_2_step_size[i];
             T0 += wire_ffts[1][i];
             T0 *= eta;
-            T0 += wire_ffts[0][(i + 4) & block_mask] * column_1_step_size[i];
+            T0 += wire_ffts[0][(i + 1) & block_mask] * column_1_step_size[i];
             T0 += wire_ffts[0][i];
 
             // Set numerator = q_lookup*f + γ
@@ -507,29 +488,29 @@ bb::fr ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_q
             numerator += gamma;
 
             // Set T0 = t(Xω) := t_1(Xω) + ηt_2(Xω) + η²t_3(Xω) + η³t_4(Xω)
-            T0 = table_ffts[3][(i + 4) & block_mask];
+            T0 = table_ffts[3][(i + 1) & block_mask];
             T0 *= eta;
-            T0 += table_ffts[2][(i + 4) & block_mask];
+            T0 += table_ffts[2][(i + 1) & block_mask];
             T0 *= eta;
-            T0 += table_ffts[1][(i + 4) & block_mask];
+            T0 += table_ffts[1][(i + 1) & block_mask];
             T0 *= eta;
-            T0 += table_ffts[0][(i + 4) & block_mask];
+            T0 += table_ffts[0][(i + 1) & block_mask];
 
             // Set T1 = (t + βt(Xω) + γ(1 + β))
             T1 = beta;
             T1 *= T0;
-            T1 += next_ts[i & 0x03UL];
+            T1 += next_t;
             T1 += gamma_beta_constant;
 
             // Set t(X) = t(Xω) for the next time around
-            next_ts[i & 0x03UL] = T0;
+            next_t = T0;
 
             // numerator = (q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)
             numerator *= T1;
             numerator *= beta_constant;
 
             // Set denominator = (s + βs(Xω) + γ(1 + β))
-            denominator = s_fft[(i + 4) & block_mask];
+            denominator = s_fft[(i + 1) & block_mask];
             denominator *= beta;
             denominator += s_fft[i];
             denominator += gamma_beta_constant;
@@ -537,7 +518,7 @@ bb::fr ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_q
             // Set T0 = αL_1(X)
             T0 = l_1[i] * alpha;
             // Set T1 = α²L_{n-k}(X) = α²L_1(Xω^{-(n-k)+1}) = α²L_1(Xω^{k+1}), k = num roots cut out of Z_H
-            T1 = l_1[(i + 4 + 4 * num_roots_cut_out_of_vanishing_polynomial) & block_mask] * alpha_sqr;
+            T1 = l_1[(i + 1 + num_roots_cut_out_of_vanishing_polynomial) & block_mask] * alpha_sqr;
 
             // Set numerator = z_lookup(X)*[(q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)] + (z_lookup -
             // 1)*αL_1(X)
@@ -547,7 +528,7 @@ bb::fr ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_q
 
             // Set denominator = z_lookup(Xω)*(s + βs(Xω) + γ(1 + β)) - [z_lookup(Xω) - [γ(1 + β)]^{n-k}]*α²L_{n-k}(X)
             denominator -= T1;
-            denominator *= z_lookup_fft[(i + 4) & block_mask];
+            denominator *= z_lookup_fft[(i + 1) & block_mask];
             denominator += T1 * delta_factor;
 
             // Combine into quotient polynomial contribution
@@ -555,8 +536,9 @@ bb::fr ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_q
             //      - z_lookup(Xω)*(s + βs(Xω) + γ(1 + β)) + [z_lookup(Xω) - [γ(1 + β)]^{n-k}]*α²L_{n-k}(X)
             T0 = numerator - denominator;
             // key->quotient_large[i] += T0 * alpha_base; // CODY: Luke did this while documenting
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)] +=
-                T0 * alpha_base;
+            const size_t coset_index = 4 * i + quarter;
+            key->quotient_polynomial_parts[coset_index >> key->small_domain.log2_size]
+                                          [coset_index & (key->circuit_size - 1)] += T0 * alpha_base;
         }
     });
     return alpha_base * alpha.sqr() * alpha;
@@ -45,8 +45,11 @@ class ProverRandomWidget {
 
     virtual void compute_round_commitments(transcript::StandardTranscript&, const size_t, work_queue&){};
 
+    // Adds the widget's terms to the quotient parts at the points of one quarter of the 4n coset (see
+    // ProverBase::compute_coset_quarter_forms), reading the "_fft" forms of that quarter.
     virtual bb::fr compute_quotient_contribution(const bb::fr& alpha_base,
-                                                 const transcript::StandardTranscript& transcript) = 0;
+                                                 const transcript::StandardTranscript& transcript,
+                                                 const size_t quarter) = 0;
 
     proving_key* key;
 };
@@ -224,8 +224,8 @@ class FFTGetter : public BaseGetter<Field, Transcript, Settings, num_widget_rela
 
         // Set block_mask and index_shift
         label_suffix = "_fft"; // coset evaluation form has suffix "_fft"
-        result.block_mask = key->large_domain.size - 1;
-        result.index_shift = 4; // for coset fft, x->ω*x corresponds to shift by 4
+        result.block_mask = key->small_domain.size - 1;
+        result.index_shift = 1; // the "_fft" forms hold one quarter of the coset, on which x->ω*x is a shift by 1
 
         // Construct the container of pointers to the required polynomials
         for (size_t i = 0; i < key->polynomial_manifest.size(); ++i) {
@@ -272,7 +272,7 @@ template <class Field> class TransitionWidgetBase {
     };
     virtual ~TransitionWidgetBase() {}
 
-    virtual Field compute_quotient_contribution(const Field&, const transcript::StandardTranscript&) = 0;
+    virtual Field compute_quotient_contribution(const Field&, const transcript::StandardTranscript&, const size_t) = 0;
 
   public:
     proving_key* key;
@@ -312,7 +312,8 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
     };
 
     Field compute_quotient_contribution(const Field& alpha_base,
-                                        const transcript::StandardTranscript& transcript) override
+                                        const transcript::StandardTranscript& transcript,
+                                        const size_t quarter) override
     {
         auto* key = TransitionWidgetBase<Field>::key;
         ASSERT(key != nullptr);
@@ -326,10 +327,13 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
         challenge_array challenges =
             FFTGetter::get_challenges(transcript, alpha_base, FFTKernel::quotient_required_challenges);
 
-        ITERATE_OVER_DOMAIN_START(key->large_domain);
+        // The polynomials hold the evaluations on one quarter of the 4n coset; point i is entry 4i + quarter of the
+        // full coset
+        ITERATE_OVER_DOMAIN_START(key->small_domain);
         // populate split quotient components
-        Field& quotient_term =
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)];
+        const size_t coset_index = 4 * i + quarter;
+        Field& quotient_term = key->quotient_polynomial_parts[coset_index >> key->small_domain.log2_size]
+                                                             [coset_index & (key->circuit_size - 1)];
         FFTKernel::accumulate_contribution(polynomials, challenges, quotient_term, i);
         ITERATE_OVER_DOMAIN_END;
 
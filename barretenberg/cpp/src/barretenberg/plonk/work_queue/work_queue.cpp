@@ -1,4 +1,7 @@
 #include "work_queue.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/timer.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -198,86 +201,156 @@ void work_queue::add_to_queue(const work_item& item)
     // #endif
 }
 
-void work_queue::process_queue()
+/**
+ * @brief Run a single work item
+ *
+ * @return The commitment computed by a SCALAR_MULTIPLICATION item. It is not added to the transcript here, since
+ * items may run concurrently.
+ */
+bb::g1::affine_element work_queue::process_item(const work_item& item)
 {
-    for (const auto& item : work_item_queue) {
-        switch (item.work_type) {
-        // most expensive op
-        case WorkType::SCALAR_MULTIPLICATION: {
-            // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
-            auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
+    switch (item.work_type) {
+    // most expensive op
+    case WorkType::SCALAR_MULTIPLICATION: {
+        // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
+        auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
 
-            ASSERT(msm_size <= key->reference_string->get_monomial_size());
+        ASSERT(msm_size <= key->reference_string->get_monomial_size());
 
-            bb::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+        bb::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
 
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = bb::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
-            bb::g1::affine_element result(bb::scalar_multiplication::pippenger_unsafe<curve::BN254>(
-                item.mul_scalars.get(), srs_points, msm_size, runtime_state));
+        // Run pippenger multi-scalar multiplication.
+        auto runtime_state = bb::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
+        bb::g1::affine_element result(bb::scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            item.mul_scalars.get(), srs_points, msm_size, runtime_state));
+
+        return result;
+    }
+    // Commenting this out as per above.
+    // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
+    // due to the need to copy memory between web workers
+    // case WorkType::SMALL_FFT: {
+    //     using namespace bb;
+    //     const size_t n = key->circuit_size;
+    //     auto wire = key->polynomial_store.get(item.tag);
 
-            transcript->add_element(item.tag, result.to_buffer());
+    //     polynomial wire_copy(wire, n);
+    //     wire_copy.coset_fft_with_generator_shift(key->small_domain, item.constant);
+
+    //     if (item.index != 0) {
+    //         auto old_wire_fft = key->polynomial_store.get(item.tag + "_fft");
+    //         for (size_t i = 0; i < n; ++i) {
+    //             old_wire_fft[4 * i + item.index] = wire_copy[i];
+    //         }
+    //         old_wire_fft[4 * n + item.index] = wire_copy[0];
+    //         key->polynomial_store.put(item.tag + "_fft", std::move(old_wire_fft));
+    //     } else {
+    //         polynomial wire_fft(4 * n + 4);
+    //         for (size_t i = 0; i < n; ++i) {
+    //             wire_fft[4 * i + item.index] = wire_copy[i];
+    //         }
+    //         key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+    //     }
+    //     break;
+    // }
+    // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
+    case WorkType::IFFT: {
+        using namespace bb;
+        // retrieve wire in lagrange form
+        auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
+
+        // Compute wire monomial form via ifft on lagrange form then add it to the store
+        polynomial wire_monomial(key->circuit_size);
+        polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
+        key->polynomial_store.put(item.tag, std::move(wire_monomial));
+
+        break;
+    }
+    default: {
+    }
+    }
+    return bb::g1::affine_element::infinity();
+}
 
-            break;
+/**
+ * @brief Process all queued work items
+ * @details A SCALAR_MULTIPLICATION item holds its own scalars, so it does not depend on any other item in the queue.
+ * IFFT items read and write the polynomial store, which is not thread safe, so they always run in queue order
+ * on a single lane. When there are enough cpus, the MSMs are spread over further lanes and all lanes run at the same
+ * time, each on its own thread with an equal share of the cpus (see run_tasks_concurrently). This keeps the machine
+ * busy while a bandwidth bound IFFT or the bucket reduction tail of a pippenger run leaves cores idle. Commitments are
+ * added to the transcript in queue order once every lane has finished. The wall clock time of each item, along with the
+ * number of cpus it ran on, is appended to item_timings.
+ */
+void work_queue::process_queue()
+{
+    const size_t num_items = work_item_queue.size();
+    std::vector<bb::g1::affine_element> results(num_items);
+    std::vector<work_item_timing> timings(num_items);
+
+    const auto run_item = [&](const size_t i) {
+        Timer timer;
+        const auto& item = work_item_queue[i];
+        results[i] = process_item(item);
+        timings[i] = { item.work_type, item.tag, get_num_cpus(), timer.milliseconds() };
+    };
+
+    std::vector<size_t> polynomial_items;
+    std::vector<size_t> msm_items;
+    for (size_t i = 0; i < num_items; ++i) {
+        if (work_item_queue[i].work_type == WorkType::SCALAR_MULTIPLICATION) {
+            msm_items.push_back(i);
+        } else {
+            polynomial_items.push_back(i);
         }
-        // Commenting this out as per above.
-        // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
-        // due to the need to copy memory between web workers
-        // case WorkType::SMALL_FFT: {
-        //     using namespace bb;
-        //     const size_t n = key->circuit_size;
-        //     auto wire = key->polynomial_store.get(item.tag);
-
-        //     polynomial wire_copy(wire, n);
-        //     wire_copy.coset_fft_with_generator_shift(key->small_domain, item.constant);
-
-        //     if (item.index != 0) {
-        //         auto old_wire_fft = key->polynomial_store.get(item.tag + "_fft");
-        //         for (size_t i = 0; i < n; ++i) {
-        //             old_wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         old_wire_fft[4 * n + item.index] = wire_copy[0];
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(old_wire_fft));
-        //     } else {
-        //         polynomial wire_fft(4 * n + 4);
-        //         for (size_t i = 0; i < n; ++i) {
-        //             wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-        //     }
-        //     break;
-        // }
-        case WorkType::FFT: {
-            using namespace bb;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
-            }
+    }
 
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+    const size_t num_cpus = get_num_cpus();
+    // Spawning threads to join them again is unreliable under wasi-sdk pthreads (see thread.cpp).
+#ifdef __wasm__
+    const size_t max_lanes = 1;
+#else
+    const size_t max_lanes = std::min(MAX_CONCURRENT_LANES, num_cpus / MIN_CPUS_PER_LANE);
+#endif
+    const size_t num_polynomial_lanes = polynomial_items.empty() ? 0 : 1;
+    const size_t num_msm_lanes =
+        std::min(msm_items.size(), max_lanes > num_polynomial_lanes ? max_lanes - num_polynomial_lanes : 0);
+    const size_t num_lanes = num_polynomial_lanes + num_msm_lanes;
 
-            break;
+    if (num_lanes <= 1) {
+        for (size_t i = 0; i < num_items; ++i) {
+            run_item(i);
         }
-        // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
-        case WorkType::IFFT: {
-            using namespace bb;
-            // retrieve wire in lagrange form
-            auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
-
-            // Compute wire monomial form via ifft on lagrange form then add it to the store
-            polynomial wire_monomial(key->circuit_size);
-            polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
-            key->polynomial_store.put(item.tag, std::move(wire_monomial));
-
-            break;
+    } else {
+        std::vector<std::vector<size_t>> lanes(num_lanes);
+        if (num_polynomial_lanes != 0) {
+            lanes[0] = polynomial_items;
         }
-        default: {
+        for (size_t j = 0; j < msm_items.size(); ++j) {
+            lanes[num_polynomial_lanes + (j % num_msm_lanes)].push_back(msm_items[j]);
         }
+
+        std::vector<BudgetedTask> tasks;
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            const size_t lane_cpus = num_cpus / num_lanes + (lane < num_cpus % num_lanes ? 1 : 0);
+            tasks.push_back({ lane_cpus, [&run_item, &lanes, lane]() {
+                                 for (const size_t i : lanes[lane]) {
+                                     run_item(i);
+                                 }
+                             } });
+        }
+        run_tasks_concurrently(tasks);
+    }
+
+    for (size_t i = 0; i < num_items; ++i) {
+        const auto& item = work_item_queue[i];
+        if (item.work_type == WorkType::SCALAR_MULTIPLICATION) {
+            transcript->add_element(item.tag, results[i].to_buffer());
         }
+        debug("work_queue item ", item.tag, " (", timings[i].num_cpus, " cpus): ", timings[i].milliseconds, "ms");
     }
+    item_timings.insert(item_timings.end(), timings.begin(), timings.end());
+
     work_item_queue = std::vector<work_item>();
 }
 
@@ -11,6 +11,8 @@ using namespace bb;
 class work_queue {
 
   public:
+    // FFT items are no longer queued, the quotient computes the coset forms it needs one quarter at a time. The value is
+    // kept so that the other work types keep their numbering.
     enum WorkType { FFT, SMALL_FFT, IFFT, SCALAR_MULTIPLICATION };
 
     struct work_item_info {
@@ -32,6 +34,17 @@ class work_queue {
         bb::fr shift_factor;
     };
 
+    struct work_item_timing {
+        WorkType work_type;
+        std::string tag;
+        size_t num_cpus;
+        int64_t milliseconds;
+    };
+
+    // Upper bound on the number of lanes process_queue runs concurrently, and the fewest cpus worth giving a lane.
+    static constexpr size_t MAX_CONCURRENT_LANES = 4;
+    static constexpr size_t MIN_CPUS_PER_LANE = 4;
+
     work_queue(proving_key* prover_key = nullptr, transcript::StandardTranscript* prover_transcript = nullptr);
 
     work_queue(const work_queue& other) = default;
@@ -63,9 +76,16 @@ class work_queue {
 
     std::vector<work_item> get_queue() const;
 
+    const std::vector<work_item_timing>& get_item_timings() const { return item_timings; }
+
+    void clear_item_timings() { item_timings.clear(); }
+
   private:
+    bb::g1::affine_element process_item(const work_item& item);
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
+    std::vector<work_item_timing> item_timings;
 };
 } // namespace bb::plonk
\ No newline at end of file
@@ -122,10 +122,12 @@ template <typename Fr> class Polynomial {
     bool is_empty() const { return size_ == 0; }
 
     /**
-     * @brief Returns an std::span of the left-shift of self.
+     * @brief Returns a view of the left-shift of self.
      *
      * @details If the n coefficients of self are (0, a₁, …, aₙ₋₁),
      * we returns the view of the n-1 coefficients (a₁, …, aₙ₋₁).
+     * The view shares the memory of self, so that shifts never need to be materialized: take a shift with shifted()
+     * rather than by copying it into a new Polynomial, and writes to self are seen through the shift.
      */
     Polynomial shifted() const;
 
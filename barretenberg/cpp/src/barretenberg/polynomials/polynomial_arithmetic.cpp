@@ -898,6 +898,46 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
     });
 }
 
+/**
+ * Compute one slice of the k*n-fft of L_1(X) computed by compute_lagrange_polynomial_fft, i.e. the n evaluations at
+ * X_{k.j + slice} for j = 0,...,n-1.
+ *
+ * These points X_{k.j + slice} = g.(w')^{slice}.w^j form a coset of the small domain, on which X^n takes the single
+ * value (g.(w')^{slice})^n. The numerator (1/n)*(X^n - 1) is therefore a constant and only the n denominators need to
+ * be inverted. The result has the same layout as a coset FFT of size n with generator shift (w')^{slice}.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void compute_lagrange_polynomial_fft_slice(Fr* l_1_coefficients,
+                                           const EvaluationDomain<Fr>& src_domain,
+                                           const EvaluationDomain<Fr>& target_domain,
+                                           const size_t slice)
+{
+    ASSERT(target_domain.log2_size >= src_domain.log2_size);
+    ASSERT(slice < (target_domain.size >> src_domain.log2_size));
+    const Fr coset_shift = src_domain.generator * target_domain.root.pow(static_cast<uint64_t>(slice));
+
+    // Step 1: Compute 1/(X_j - 1) for X_j = g.(w')^{slice}.w^j, j = 0,...,n-1
+    parallel_for(src_domain.num_threads, [&](size_t j) {
+        Fr work_root = coset_shift * src_domain.root.pow(static_cast<uint64_t>(j * src_domain.thread_size));
+        size_t offset = j * src_domain.thread_size;
+        for (size_t i = offset; i < offset + src_domain.thread_size; ++i) {
+            l_1_coefficients[i] = work_root - Fr::one();
+            work_root *= src_domain.root;
+        }
+    });
+    Fr::batch_invert(l_1_coefficients, src_domain.size);
+
+    // Step 2: Multiply by the numerator (1/n)*(X_j^n - 1), which is the same for every point of the slice
+    Fr numerator = coset_shift.pow(static_cast<uint64_t>(src_domain.size)) - Fr::one();
+    numerator *= src_domain.domain_inverse;
+    parallel_for(src_domain.num_threads, [&](size_t i) {
+        for (size_t j = 0; j < src_domain.thread_size; ++j) {
+            l_1_coefficients[i * src_domain.thread_size + j] *= numerator;
+        }
+    });
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
@@ -1395,6 +1435,10 @@ template void add<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void sub<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void mul<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void compute_lagrange_polynomial_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&);
+template void compute_lagrange_polynomial_fft_slice<fr>(fr*,
+                                                        const EvaluationDomain<fr>&,
+                                                        const EvaluationDomain<fr>&,
+                                                        const size_t);
 template void divide_by_pseudo_vanishing_polynomial<fr>(std::vector<fr*>,
                                                         const EvaluationDomain<fr>&,
                                                         const EvaluationDomain<fr>&,
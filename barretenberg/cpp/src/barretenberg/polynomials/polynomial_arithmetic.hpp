@@ -136,6 +136,15 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
                                      const EvaluationDomain<Fr>& src_domain,
                                      const EvaluationDomain<Fr>& target_domain);
 
+// Compute the evaluations of L_1(X) at X_{k*j + slice}, j = 0,...,n-1, i.e. every k'th entry of the vector computed by
+// compute_lagrange_polynomial_fft, starting at `slice`. `l_1_coefficients` must have n = src_domain.size entries.
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void compute_lagrange_polynomial_fft_slice(Fr* l_1_coefficients,
+                                           const EvaluationDomain<Fr>& src_domain,
+                                           const EvaluationDomain<Fr>& target_domain,
+                                           const size_t slice);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
@@ -283,6 +283,58 @@ TEST(polynomials, fft_coset_ifft_cross_consistency)
     }
 }
 
+TEST(polynomials, coset_fft_quarters_match_large_coset_fft)
+{
+    constexpr size_t n = 256;
+    auto small_domain = evaluation_domain(n);
+    auto large_domain = evaluation_domain(4 * n);
+    small_domain.compute_lookup_table();
+    large_domain.compute_lookup_table();
+
+    fr poly[4 * n];
+    for (size_t i = 0; i < n; ++i) {
+        poly[i] = fr::random_element();
+    }
+    for (size_t i = n; i < 4 * n; ++i) {
+        poly[i] = fr::zero();
+    }
+    fr expected[4 * n];
+    polynomial_arithmetic::copy_polynomial(poly, expected, 4 * n, 4 * n);
+    polynomial_arithmetic::coset_fft(expected, large_domain);
+
+    // Entries 4i + q of the 4n coset FFT are the evaluations on the n-sized coset shifted by (w')^q
+    fr quarter[n];
+    for (size_t q = 0; q < 4; ++q) {
+        polynomial_arithmetic::copy_polynomial(poly, quarter, n, n);
+        polynomial_arithmetic::coset_fft_with_generator_shift(
+            quarter, small_domain, large_domain.root.pow(static_cast<uint64_t>(q)));
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(quarter[i], expected[4 * i + q]);
+        }
+    }
+}
+
+TEST(polynomials, compute_lagrange_polynomial_fft_slice)
+{
+    constexpr size_t n = 256;
+    constexpr size_t M = 4;
+    auto small_domain = evaluation_domain(n);
+    auto large_domain = evaluation_domain(M * n);
+    small_domain.compute_lookup_table();
+    large_domain.compute_lookup_table();
+
+    fr expected[M * n];
+    polynomial_arithmetic::compute_lagrange_polynomial_fft(expected, small_domain, large_domain);
+
+    fr slice[n];
+    for (size_t q = 0; q < M; ++q) {
+        polynomial_arithmetic::compute_lagrange_polynomial_fft_slice(slice, small_domain, large_domain, q);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(slice[i], expected[M * i + q]);
+        }
+    }
+}
+
 /**
  * @brief Test function compute_lagrange_polynomial_fft() on medium domain (size 2 * n)
  */
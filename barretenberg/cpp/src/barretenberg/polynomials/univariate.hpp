@@ -95,6 +95,16 @@ template <class Fr, size_t domain_end, size_t domain_start = 0> class Univariate
 
     static Univariate random_element() { return get_random(); };
 
+    bool is_zero() const
+    {
+        for (const auto& eval : evaluations) {
+            if (!eval.is_zero()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     // Operations between Univariate and other Univariate
     bool operator==(const Univariate& other) const = default;
 
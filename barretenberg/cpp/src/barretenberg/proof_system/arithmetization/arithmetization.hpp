@@ -32,6 +32,13 @@ namespace bb {
  * We should only do this if it becomes necessary or convenient.
  */
 
+/**
+ * @brief Presets for the capacities of the blocks of a structured execution trace
+ * @details In a structured trace every block is placed at a fixed offset given by the capacities of the blocks
+ * preceding it, so that all circuits built with the same setting share the same layout and dyadic size.
+ */
+enum class TraceStructure { NONE, SMALL_TEST, CLIENT_IVC_BENCH };
+
 /**
  * @brief Basic structure for storing gate data in a builder
  *
@@ -49,6 +56,7 @@ template <typename FF, size_t NUM_WIRES, size_t NUM_SELECTORS> class ExecutionTr
     Wires wires; // vectors of indices into a witness variables array
     Selectors selectors;
     bool has_ram_rom = false; // does the block contain RAM/ROM gates
+    uint32_t fixed_size = 0;  // capacity of the block in a structured trace (0 if the trace is not structured)
 
     bool operator==(const ExecutionTraceBlock& other) const = default;
 
@@ -65,6 +73,49 @@ template <typename FF, size_t NUM_WIRES, size_t NUM_SELECTORS> class ExecutionTr
     }
 };
 
+/**
+ * @brief Structured trace helpers shared by the TraceBlocks of each arithmetization
+ * @details The derived TraceBlocks provides get() and a static get_fixed_block_sizes(setting) giving the capacity
+ * of each block in the order of get().
+ *
+ * @tparam TraceBlocks the derived TraceBlocks struct (CRTP)
+ */
+template <typename TraceBlocks> struct StructuredTraceBlocks {
+    /**
+     * @brief Set the capacity of each block for a structured execution trace
+     * @note Gates are currently all constructed in the main block, so the other gate type blocks are left empty
+     */
+    void set_fixed_block_sizes(TraceStructure setting)
+    {
+        const auto fixed_block_sizes = TraceBlocks::get_fixed_block_sizes(setting);
+        auto blocks = static_cast<TraceBlocks&>(*this).get();
+        for (size_t idx = 0; idx < fixed_block_sizes.size(); ++idx) {
+            blocks[idx].fixed_size = fixed_block_sizes[idx];
+        }
+    }
+
+    bool is_structured()
+    {
+        for (auto& block : static_cast<TraceBlocks&>(*this).get()) {
+            if (block.fixed_size > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t get_structured_size()
+    {
+        size_t total = 0;
+        for (auto& block : static_cast<TraceBlocks&>(*this).get()) {
+            total += block.fixed_size;
+        }
+        return total;
+    }
+
+    bool operator==(const StructuredTraceBlocks& other) const = default;
+};
+
 // These are not magic numbers and they should not be written with global constants. These parameters are not
 // accessible through clearly named static class members.
 template <typename FF_> class StandardArith {
@@ -140,7 +191,7 @@ template <typename FF_> class UltraArith {
         auto& q_lookup_type() { return this->selectors[10]; };
     };
 
-    struct TraceBlocks {
+    struct TraceBlocks : public StructuredTraceBlocks<TraceBlocks> {
         UltraTraceBlock pub_inputs;
         UltraTraceBlock arithmetic;
         UltraTraceBlock sort;
@@ -152,8 +203,29 @@ template <typename FF_> class UltraArith {
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/867): update to aux.has_ram_rom = true
         TraceBlocks() { main.has_ram_rom = true; }
 
+        static constexpr size_t NUM_BLOCKS = 7;
+
         auto get() { return RefArray{ pub_inputs, arithmetic, sort, elliptic, aux, lookup, main }; }
 
+        /**
+         * @brief Capacity of each block, in the order of get(), for a structured execution trace setting
+         */
+        static std::array<uint32_t, NUM_BLOCKS> get_fixed_block_sizes(TraceStructure setting)
+        {
+            std::array<uint32_t, NUM_BLOCKS> fixed_block_sizes{}; // in the order of get()
+            switch (setting) {
+            case TraceStructure::NONE:
+                break;
+            case TraceStructure::SMALL_TEST:
+                fixed_block_sizes = { 1 << 4, 0, 0, 0, 0, 0, 1 << 12 };
+                break;
+            case TraceStructure::CLIENT_IVC_BENCH:
+                fixed_block_sizes = { 1 << 7, 0, 0, 0, 0, 0, 1 << 16 };
+                break;
+            }
+            return fixed_block_sizes;
+        }
+
         bool operator==(const TraceBlocks& other) const = default;
     };
 
@@ -232,7 +304,7 @@ template <typename FF_> class UltraHonkArith {
         };
     };
 
-    struct TraceBlocks {
+    struct TraceBlocks : public StructuredTraceBlocks<TraceBlocks> {
         UltraHonkTraceBlock ecc_op;
         UltraHonkTraceBlock pub_inputs;
         UltraHonkTraceBlock arithmetic;
@@ -247,12 +319,33 @@ template <typename FF_> class UltraHonkArith {
 
         TraceBlocks() { main.has_ram_rom = true; }
 
+        static constexpr size_t NUM_BLOCKS = 11;
+
         auto get()
         {
             return RefArray{ ecc_op,  pub_inputs,        arithmetic,        sort, elliptic, aux, lookup,
                              busread, poseidon_external, poseidon_internal, main };
         }
 
+        /**
+         * @brief Capacity of each block, in the order of get(), for a structured execution trace setting
+         */
+        static std::array<uint32_t, NUM_BLOCKS> get_fixed_block_sizes(TraceStructure setting)
+        {
+            std::array<uint32_t, NUM_BLOCKS> fixed_block_sizes{}; // in the order of get()
+            switch (setting) {
+            case TraceStructure::NONE:
+                break;
+            case TraceStructure::SMALL_TEST:
+                fixed_block_sizes = { 1 << 10, 1 << 4, 0, 0, 0, 0, 0, 0, 0, 0, 1 << 12 };
+                break;
+            case TraceStructure::CLIENT_IVC_BENCH:
+                fixed_block_sizes = { 1 << 10, 1 << 7, 0, 0, 0, 0, 0, 0, 0, 0, 1 << 16 };
+                break;
+            }
+            return fixed_block_sizes;
+        }
+
         bool operator==(const TraceBlocks& other) const = default;
     };
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <array>
 #include <cstdint>
 
 // TODO(#557): The field-specific aliases for gates should be removed and the type could be explicit when this
@@ -133,6 +134,17 @@ template <typename FF> struct ecc_dbl_gate_ {
     uint32_t y3;
 };
 
+template <typename FF> struct non_native_field_witnesses {
+    // first 4 array elements = limbs
+    // 5th element = prime basis limb
+    std::array<uint32_t, 5> a;
+    std::array<uint32_t, 5> b;
+    std::array<uint32_t, 5> q;
+    std::array<uint32_t, 5> r;
+    std::array<FF, 5> neg_modulus;
+    FF modulus;
+};
+
 template <typename FF> struct databus_lookup_gate_ {
     uint32_t index;
     uint32_t value;
@@ -0,0 +1,641 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/proof_system/arithmetization/gate_data.hpp"
+#include "barretenberg/proof_system/plookup_tables/types.hpp"
+#include "barretenberg/proof_system/types/circuit_type.hpp"
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A builder that executes stdlib gadgets natively, without recording a circuit.
+ *
+ * @details Exposes the interface of UltraCircuitBuilder, including lookups, ROM/RAM and the non-native field methods,
+ * so any stdlib primitive templated on a builder (bigfield, biggroup, ...) can be run over it to compute its outputs
+ * (e.g. to precompute public inputs or to test-run a circuit before building it). Gadgets take the same code paths as
+ * on UltraCircuitBuilder. Only the value of each variable is stored: no gates, wires, selectors, range lists, memory
+ * records or copy cycles are kept. Instead, every constraint is checked against the witness the moment it is created
+ * and the first violation is recorded through failure(), so that failed() after execution is equivalent to
+ * check_circuit() on a real builder.
+ */
+class CircuitSimulatorBN254 {
+  public:
+    using FF = bb::fr;
+    using scaled_witness = std::pair<uint32_t, FF>;
+    using add_simple = std::tuple<scaled_witness, scaled_witness, FF>;
+
+    static constexpr CircuitType CIRCUIT_TYPE = CircuitType::ULTRA;
+    static constexpr size_t UINT_LOG2_BASE = 2;
+    static constexpr size_t DEFAULT_PLOOKUP_RANGE_BITNUM = 14;
+    static constexpr size_t DEFAULT_NON_NATIVE_FIELD_LIMB_BITS = 68;
+    static constexpr uint32_t UNINITIALIZED_MEMORY_RECORD = UINT32_MAX;
+
+    std::vector<FF> variables;
+    std::vector<uint32_t> public_inputs;
+    std::map<FF, uint32_t> constant_variable_indices;
+
+    uint32_t zero_idx = 0;
+    uint32_t one_idx = 1;
+
+    CircuitSimulatorBN254(const size_t size_hint = 0)
+    {
+        variables.reserve(size_hint);
+        zero_idx = put_constant_variable(FF::zero());
+        one_idx = put_constant_variable(FF::one());
+    }
+    CircuitSimulatorBN254(const CircuitSimulatorBN254& other) = delete;
+    CircuitSimulatorBN254(CircuitSimulatorBN254&& other) = default;
+    CircuitSimulatorBN254& operator=(const CircuitSimulatorBN254& other) = delete;
+    CircuitSimulatorBN254& operator=(CircuitSimulatorBN254&& other) = default;
+    ~CircuitSimulatorBN254() = default;
+
+    size_t get_num_gates() const { return 0; }
+    size_t get_num_constant_gates() const { return 0; }
+    size_t get_num_variables() const { return variables.size(); }
+    size_t get_num_public_inputs() const { return public_inputs.size(); }
+
+    uint32_t add_variable(const FF& in)
+    {
+        variables.emplace_back(in);
+        return static_cast<uint32_t>(variables.size()) - 1;
+    }
+
+    uint32_t add_public_variable(const FF& in)
+    {
+        const uint32_t index = add_variable(in);
+        public_inputs.emplace_back(index);
+        return index;
+    }
+
+    void set_public_input(const uint32_t witness_index) { public_inputs.emplace_back(witness_index); }
+
+    FF get_variable(const uint32_t index) const
+    {
+        ASSERT(index < variables.size());
+        return variables[index];
+    }
+
+    FF get_public_input(const uint32_t index) const { return get_variable(public_inputs[index]); }
+
+    std::vector<FF> get_public_inputs() const
+    {
+        std::vector<FF> result;
+        result.reserve(public_inputs.size());
+        for (const auto index : public_inputs) {
+            result.emplace_back(get_variable(index));
+        }
+        return result;
+    }
+
+    bool is_valid_variable(uint32_t variable_index) const { return variable_index < variables.size(); };
+
+    uint32_t put_constant_variable(const FF& variable)
+    {
+        if (const auto it = constant_variable_indices.find(variable); it != constant_variable_indices.end()) {
+            return it->second;
+        }
+        const uint32_t variable_index = add_variable(variable);
+        constant_variable_indices.insert({ variable, variable_index });
+        return variable_index;
+    }
+
+    // Constants are stored directly in the variable vector, so fixing a witness is just a check of its value
+    void fix_witness(const uint32_t witness_index, const FF& witness_value)
+    {
+        check(get_variable(witness_index) == witness_value, "fix_witness");
+    }
+
+    void assert_equal(const uint32_t a_idx, const uint32_t b_idx, std::string const& msg = "assert_equal")
+    {
+        check(get_variable(a_idx) == get_variable(b_idx), msg);
+    }
+
+    void assert_equal_constant(uint32_t const a_idx, FF const& b, std::string const& msg = "assert equal constant")
+    {
+        check(get_variable(a_idx) == b, msg);
+    }
+
+    void create_add_gate(const add_triple_<FF>& in)
+    {
+        consume_next_gate_w_4(zero_idx);
+        check(in.a_scaling * get_variable(in.a) + in.b_scaling * get_variable(in.b) +
+                      in.c_scaling * get_variable(in.c) + in.const_scaling ==
+                  FF::zero(),
+              "create_add_gate");
+    }
+
+    /**
+     * @brief Check a width-4 addition gate
+     *
+     * @details If use_next_gate_w_4 is set, the 4th wire of the next gate is added to the sum, as in
+     * UltraCircuitBuilder. The partial sum is then kept until the next gate is created and checked against its 4th
+     * wire.
+     */
+    void create_big_add_gate(const add_quad_<FF>& in, const bool use_next_gate_w_4 = false)
+    {
+        consume_next_gate_w_4(in.d);
+        const FF sum = in.a_scaling * get_variable(in.a) + in.b_scaling * get_variable(in.b) +
+                       in.c_scaling * get_variable(in.c) + in.d_scaling * get_variable(in.d) + in.const_scaling;
+        if (use_next_gate_w_4) {
+            next_gate_w_4_term = sum;
+        } else {
+            check(sum == FF::zero(), "create_big_add_gate");
+        }
+    }
+
+    void create_mul_gate(const mul_triple_<FF>& in)
+    {
+        consume_next_gate_w_4(zero_idx);
+        check(in.mul_scaling * get_variable(in.a) * get_variable(in.b) + in.c_scaling * get_variable(in.c) +
+                      in.const_scaling ==
+                  FF::zero(),
+              "create_mul_gate");
+    }
+
+    void create_big_mul_gate(const mul_quad_<FF>& in)
+    {
+        consume_next_gate_w_4(in.d);
+        check(in.mul_scaling * get_variable(in.a) * get_variable(in.b) + in.a_scaling * get_variable(in.a) +
+                      in.b_scaling * get_variable(in.b) + in.c_scaling * get_variable(in.c) +
+                      in.d_scaling * get_variable(in.d) + in.const_scaling ==
+                  FF::zero(),
+              "create_big_mul_gate");
+    }
+
+    void create_bool_gate(const uint32_t a)
+    {
+        consume_next_gate_w_4(zero_idx);
+        const FF value = get_variable(a);
+        check(value * value == value, "create_bool_gate");
+    }
+
+    void create_poly_gate(const poly_triple_<FF>& in)
+    {
+        consume_next_gate_w_4(zero_idx);
+        const FF a = get_variable(in.a);
+        const FF b = get_variable(in.b);
+        check(in.q_m * a * b + in.q_l * a + in.q_r * b + in.q_o * get_variable(in.c) + in.q_c == FF::zero(),
+              "create_poly_gate");
+    }
+
+    /**
+     * @brief Check that (x3, y3) = (x1, y1) + sign * (x2, y2), using the same identities as the elliptic relation
+     */
+    void create_ecc_add_gate(const ecc_add_gate_<FF>& in)
+    {
+        consume_next_gate_w_4(zero_idx);
+        const FF x1 = get_variable(in.x1);
+        const FF y1 = get_variable(in.y1);
+        const FF x2 = get_variable(in.x2);
+        const FF y2 = get_variable(in.y2) * in.sign_coefficient;
+        const FF x3 = get_variable(in.x3);
+        const FF y3 = get_variable(in.y3);
+        const FF x_diff = x2 - x1;
+        const FF x_identity = (x3 + x2 + x1) * x_diff.sqr() - y2.sqr() - y1.sqr() + y1 * y2 + y1 * y2;
+        const FF y_identity = (y3 + y1) * x_diff + (x3 - x1) * (y2 - y1);
+        check(x_identity == FF::zero() && y_identity == FF::zero(), "create_ecc_add_gate");
+    }
+
+    /**
+     * @brief Check that (x3, y3) = 2 * (x1, y1) on a short Weierstrass curve with a = 0
+     */
+    void create_ecc_dbl_gate(const ecc_dbl_gate_<FF>& in)
+    {
+        consume_next_gate_w_4(zero_idx);
+        const FF x1 = get_variable(in.x1);
+        const FF y1 = get_variable(in.y1);
+        const FF x3 = get_variable(in.x3);
+        const FF y3 = get_variable(in.y3);
+        const FF x1_sqr = x1.sqr();
+        const FF x_identity = (x3 + x1 + x1) * (y1 + y1).sqr() - x1_sqr.sqr() * FF(9);
+        const FF y_identity = (y1 + y3) * (y1 + y1) - x1_sqr * FF(3) * (x1 - x3);
+        check(x_identity == FF::zero() && y_identity == FF::zero(), "create_ecc_dbl_gate");
+    }
+
+    /**
+     * @brief Compute the base-4 accumulators of a witness without constraining them
+     *
+     * @details Produces the same accumulator values as StandardCircuitBuilder, from the most significant quad down, so
+     * that gadgets reading them (e.g. uint) behave identically.
+     */
+    std::vector<uint32_t> decompose_into_base4_accumulators(const uint32_t witness_index,
+                                                            const size_t num_bits,
+                                                            std::string const& msg = "create_range_constraint")
+    {
+        ASSERT(num_bits > 0);
+        const uint256_t target(get_variable(witness_index));
+        check(target.get_msb() < num_bits || target == 0, msg);
+
+        const size_t num_quads = (num_bits + 1) >> 1;
+        const uint256_t truncated = target.slice(0, num_bits);
+        std::vector<uint32_t> accumulators;
+        accumulators.reserve(num_quads);
+        for (size_t i = num_quads - 1; i < num_quads; --i) {
+            accumulators.emplace_back(add_variable(FF(truncated >> (2 * i))));
+        }
+        return accumulators;
+    }
+
+    void create_new_range_constraint(const uint32_t variable_index,
+                                     const uint64_t target_range,
+                                     std::string const msg = "create_new_range_constraint")
+    {
+        check(uint256_t(get_variable(variable_index)) <= target_range, msg);
+    }
+
+    void create_range_constraint(const uint32_t variable_index,
+                                 const size_t num_bits,
+                                 std::string const& msg = "create_range_constraint")
+    {
+        if (num_bits == 1) {
+            create_bool_gate(variable_index);
+        } else if (num_bits <= DEFAULT_PLOOKUP_RANGE_BITNUM) {
+            consume_next_gate_w_4(zero_idx);
+            create_new_range_constraint(variable_index, (1ULL << num_bits) - 1, msg);
+        } else {
+            decompose_into_default_range(variable_index, num_bits, DEFAULT_PLOOKUP_RANGE_BITNUM, msg);
+        }
+    }
+
+    /**
+     * @brief Split a witness into target_range_bitnum-bit sublimbs, least significant first
+     *
+     * @details Produces the same sublimbs as UltraCircuitBuilder. The sublimbs are summed back into the witness three
+     * at a time, with each addition gate reading the remaining accumulator from the 4th wire of the next one.
+     */
+    std::vector<uint32_t> decompose_into_default_range(
+        const uint32_t variable_index,
+        const uint64_t num_bits,
+        const uint64_t target_range_bitnum = DEFAULT_PLOOKUP_RANGE_BITNUM,
+        std::string const& msg = "decompose_into_default_range")
+    {
+        ASSERT(num_bits > 0);
+        const uint256_t value(get_variable(variable_index));
+        check(value.get_msb() < num_bits, msg);
+
+        const uint64_t sublimb_mask = (1ULL << target_range_bitnum) - 1;
+        const bool has_remainder_bits = (num_bits % target_range_bitnum != 0);
+        const uint64_t num_limbs = (num_bits / target_range_bitnum) + has_remainder_bits;
+        const uint64_t last_limb_range = (1ULL << (num_bits % target_range_bitnum)) - 1;
+
+        std::vector<uint32_t> sublimb_indices;
+        sublimb_indices.reserve(num_limbs);
+        for (size_t i = 0; i < num_limbs; ++i) {
+            const uint32_t limb_idx = add_variable(FF((value >> (i * target_range_bitnum)).data[0] & sublimb_mask));
+            const bool is_last_limb = (i == num_limbs - 1) && has_remainder_bits;
+            create_new_range_constraint(limb_idx, is_last_limb ? last_limb_range : sublimb_mask);
+            sublimb_indices.emplace_back(limb_idx);
+        }
+
+        const uint64_t num_limb_triples = (num_limbs + 2) / 3;
+        uint256_t accumulator = value;
+        uint32_t accumulator_idx = variable_index;
+        for (size_t i = 0; i < num_limb_triples; ++i) {
+            std::array<uint32_t, 3> limbs{ zero_idx, zero_idx, zero_idx };
+            std::array<FF, 3> scalings;
+            for (size_t j = 0; j < 3; ++j) {
+                const size_t limb = 3 * i + j;
+                scalings[j] = uint256_t(1) << (target_range_bitnum * limb);
+                if (limb < num_limbs) {
+                    limbs[j] = sublimb_indices[limb];
+                    accumulator -= uint256_t(get_variable(limbs[j])) << (target_range_bitnum * limb);
+                }
+            }
+            create_big_add_gate(
+                { limbs[0], limbs[1], limbs[2], accumulator_idx, scalings[0], scalings[1], scalings[2], -1, 0 },
+                i != num_limb_triples - 1);
+            accumulator_idx = add_variable(FF(accumulator));
+        }
+        return sublimb_indices;
+    }
+
+    /**
+     * @brief Check that the two limbs fit in lo_limb_bits and hi_limb_bits respectively
+     */
+    void range_constrain_two_limbs(const uint32_t lo_idx,
+                                   const uint32_t hi_idx,
+                                   const size_t lo_limb_bits = DEFAULT_NON_NATIVE_FIELD_LIMB_BITS,
+                                   const size_t hi_limb_bits = DEFAULT_NON_NATIVE_FIELD_LIMB_BITS)
+    {
+        ASSERT(lo_limb_bits <= (14 * 5));
+        ASSERT(hi_limb_bits <= (14 * 5));
+        consume_next_gate_w_4(lo_idx);
+        check(uint256_t(get_variable(lo_idx)).get_msb() < lo_limb_bits || get_variable(lo_idx) == FF::zero(),
+              "range_constrain_two_limbs: lo limb");
+        check(uint256_t(get_variable(hi_idx)).get_msb() < hi_limb_bits || get_variable(hi_idx) == FF::zero(),
+              "range_constrain_two_limbs: hi limb");
+    }
+
+    std::array<uint32_t, 2> decompose_non_native_field_double_width_limb(
+        const uint32_t limb_idx, const size_t num_limb_bits = (2 * DEFAULT_NON_NATIVE_FIELD_LIMB_BITS))
+    {
+        ASSERT(num_limb_bits > DEFAULT_NON_NATIVE_FIELD_LIMB_BITS);
+        const uint256_t value(get_variable(limb_idx));
+        const uint32_t lo_idx = add_variable(FF(value.slice(0, DEFAULT_NON_NATIVE_FIELD_LIMB_BITS)));
+        const uint32_t hi_idx = add_variable(FF(value >> DEFAULT_NON_NATIVE_FIELD_LIMB_BITS));
+        range_constrain_two_limbs(
+            lo_idx, hi_idx, DEFAULT_NON_NATIVE_FIELD_LIMB_BITS, num_limb_bits - DEFAULT_NON_NATIVE_FIELD_LIMB_BITS);
+        return { lo_idx, hi_idx };
+    }
+
+    /**
+     * @brief Compute the carries of the non-native field multiplication a * b = q * p + r
+     *
+     * @details Returns the witness indices of the low and high carries `lo_1, hi_3`, with the same values as
+     * UltraCircuitBuilder, and checks the gates that link them and the limbs of q and r. As on the real builder, the
+     * caller is responsible for range constraining the carries and for the prime basis limb identity.
+     */
+    std::array<uint32_t, 2> evaluate_non_native_field_multiplication(
+        const non_native_field_witnesses<FF>& input, const bool range_constrain_quotient_and_remainder = true)
+    {
+        std::array<FF, 4> a;
+        std::array<FF, 4> b;
+        std::array<FF, 4> q;
+        std::array<FF, 4> r;
+        for (size_t i = 0; i < 4; ++i) {
+            a[i] = get_variable(input.a[i]);
+            b[i] = get_variable(input.b[i]);
+            q[i] = get_variable(input.q[i]);
+            r[i] = get_variable(input.r[i]);
+        }
+        const auto& p = input.neg_modulus;
+        constexpr FF LIMB_SHIFT = uint256_t(1) << DEFAULT_NON_NATIVE_FIELD_LIMB_BITS;
+        constexpr FF LIMB_SHIFT_2 = uint256_t(1) << (2 * DEFAULT_NON_NATIVE_FIELD_LIMB_BITS);
+        constexpr FF LIMB_SHIFT_3 = uint256_t(1) << (3 * DEFAULT_NON_NATIVE_FIELD_LIMB_BITS);
+        constexpr FF LIMB_RSHIFT = FF(1) / FF(uint256_t(1) << DEFAULT_NON_NATIVE_FIELD_LIMB_BITS);
+        constexpr FF LIMB_RSHIFT_2 = FF(1) / FF(uint256_t(1) << (2 * DEFAULT_NON_NATIVE_FIELD_LIMB_BITS));
+
+        const FF lo_0 = a[0] * b[0] - r[0] + (a[1] * b[0] + a[0] * b[1]) * LIMB_SHIFT;
+        const FF lo_1 = (lo_0 + q[0] * p[0] + (q[1] * p[0] + q[0] * p[1] - r[1]) * LIMB_SHIFT) * LIMB_RSHIFT_2;
+        const FF hi_0 = a[2] * b[0] + a[0] * b[2] + (a[0] * b[3] + a[3] * b[0] - r[3]) * LIMB_SHIFT;
+        const FF hi_1 = hi_0 + a[1] * b[1] - r[2] + (a[1] * b[2] + a[2] * b[1]) * LIMB_SHIFT;
+        const FF hi_2 = hi_1 + lo_1 + q[2] * p[0] + (q[3] * p[0] + q[2] * p[1]) * LIMB_SHIFT;
+        const FF hi_3 =
+            (hi_2 + (q[0] * p[3] + q[1] * p[2]) * LIMB_SHIFT + (q[0] * p[2] + q[1] * p[1])) * LIMB_RSHIFT_2;
+
+        const uint32_t lo_0_idx = add_variable(lo_0);
+        const uint32_t lo_1_idx = add_variable(lo_1);
+        const uint32_t hi_1_idx = add_variable(hi_1);
+        const uint32_t hi_2_idx = add_variable(hi_2);
+        const uint32_t hi_3_idx = add_variable(hi_3);
+
+        if (range_constrain_quotient_and_remainder) {
+            create_big_add_gate(
+                { input.r[1], input.r[2], input.r[3], input.r[4], LIMB_SHIFT, LIMB_SHIFT_2, LIMB_SHIFT_3, -1, 0 },
+                true);
+            range_constrain_two_limbs(input.r[0], input.r[1]);
+            range_constrain_two_limbs(input.r[2], input.r[3]);
+            create_big_add_gate(
+                { input.q[1], input.q[2], input.q[3], input.q[4], LIMB_SHIFT, LIMB_SHIFT_2, LIMB_SHIFT_3, -1, 0 },
+                true);
+            range_constrain_two_limbs(input.q[0], input.q[1]);
+            range_constrain_two_limbs(input.q[2], input.q[3]);
+        }
+
+        // The product gates read lo_0, hi_0 and hi_1 from the limb products directly, so only the gates linking the
+        // carries remain to be checked
+        create_big_add_gate({ input.q[0],
+                              input.q[1],
+                              input.r[1],
+                              lo_1_idx,
+                              p[0] + p[1] * LIMB_SHIFT,
+                              p[0] * LIMB_SHIFT,
+                              -LIMB_SHIFT,
+                              -LIMB_SHIFT.sqr(),
+                              0 },
+                            true);
+        consume_next_gate_w_4(lo_0_idx);
+        create_big_add_gate(
+            { input.q[2], input.q[3], lo_1_idx, hi_1_idx, -p[1] * LIMB_SHIFT - p[0], -p[0] * LIMB_SHIFT, -1, -1, 0 },
+            true);
+        create_big_add_gate({
+            hi_3_idx,
+            input.q[0],
+            input.q[1],
+            hi_2_idx,
+            -1,
+            p[3] * LIMB_RSHIFT + p[2] * LIMB_RSHIFT_2,
+            p[2] * LIMB_RSHIFT + p[1] * LIMB_RSHIFT_2,
+            LIMB_RSHIFT_2,
+            0,
+        });
+
+        return { lo_1_idx, hi_3_idx };
+    }
+
+    /**
+     * @brief Compute the low and high 204-bit halves `lo_0, hi_1` of the limb products of a * b
+     */
+    std::array<uint32_t, 2> queue_partial_non_native_field_multiplication(const non_native_field_witnesses<FF>& input)
+    {
+        std::array<FF, 4> a;
+        std::array<FF, 4> b;
+        for (size_t i = 0; i < 4; ++i) {
+            a[i] = get_variable(input.a[i]);
+            b[i] = get_variable(input.b[i]);
+        }
+        constexpr FF LIMB_SHIFT = uint256_t(1) << DEFAULT_NON_NATIVE_FIELD_LIMB_BITS;
+
+        const FF lo_0 = a[0] * b[0] + (a[1] * b[0] + a[0] * b[1]) * LIMB_SHIFT;
+        const FF hi_0 = a[2] * b[0] + a[0] * b[2] + (a[0] * b[3] + a[3] * b[0]) * LIMB_SHIFT;
+        const FF hi_1 = hi_0 + a[1] * b[1] + (a[1] * b[2] + a[2] * b[1]) * LIMB_SHIFT;
+
+        return { add_variable(lo_0), add_variable(hi_1) };
+    }
+
+    std::array<uint32_t, 5> evaluate_non_native_field_addition(add_simple limb0,
+                                                               add_simple limb1,
+                                                               add_simple limb2,
+                                                               add_simple limb3,
+                                                               std::tuple<uint32_t, uint32_t, FF> limbp)
+    {
+        return evaluate_non_native_field_linear_combination({ limb0, limb1, limb2, limb3 }, limbp, FF::one());
+    }
+
+    std::array<uint32_t, 5> evaluate_non_native_field_subtraction(add_simple limb0,
+                                                                  add_simple limb1,
+                                                                  add_simple limb2,
+                                                                  add_simple limb3,
+                                                                  std::tuple<uint32_t, uint32_t, FF> limbp)
+    {
+        return evaluate_non_native_field_linear_combination({ limb0, limb1, limb2, limb3 }, limbp, -FF::one());
+    }
+
+    /**
+     * @brief Perform a series of lookups, one for each 'row' in read_values
+     *
+     * @details The accumulators are computed natively from the tables, so only the keys need to be checked against
+     * the first row.
+     */
+    plookup::ReadData<uint32_t> create_gates_from_plookup_accumulators(
+        [[maybe_unused]] const plookup::MultiTableId& id,
+        const plookup::ReadData<FF>& read_values,
+        const uint32_t key_a_index,
+        std::optional<uint32_t> key_b_index = std::nullopt)
+    {
+        using plookup::ColumnIdx;
+        consume_next_gate_w_4(zero_idx);
+        const size_t num_lookups = read_values[ColumnIdx::C1].size();
+        check(num_lookups > 0 && get_variable(key_a_index) == read_values[ColumnIdx::C1][0], "plookup: key a");
+        if (key_b_index.has_value()) {
+            check(num_lookups > 0 && get_variable(key_b_index.value()) == read_values[ColumnIdx::C2][0],
+                  "plookup: key b");
+        }
+
+        plookup::ReadData<uint32_t> read_data;
+        for (size_t i = 0; i < num_lookups; ++i) {
+            read_data[ColumnIdx::C1].push_back(i == 0 ? key_a_index : add_variable(read_values[ColumnIdx::C1][i]));
+            read_data[ColumnIdx::C2].push_back((i == 0 && key_b_index.has_value())
+                                                   ? key_b_index.value()
+                                                   : add_variable(read_values[ColumnIdx::C2][i]));
+            read_data[ColumnIdx::C3].push_back(add_variable(read_values[ColumnIdx::C3][i]));
+        }
+        return read_data;
+    }
+
+    /**
+     * Memory
+     *
+     * ROM and RAM arrays only track which witness each cell holds. Cell indices passed as values are circuit constants,
+     * so they are asserted; reads and writes at a witness index that is out of bounds or uninitialized are failures.
+     **/
+
+    size_t create_ROM_array(const size_t array_size)
+    {
+        rom_arrays.emplace_back(array_size,
+                                std::array<uint32_t, 2>{ UNINITIALIZED_MEMORY_RECORD, UNINITIALIZED_MEMORY_RECORD });
+        return rom_arrays.size() - 1;
+    }
+
+    void set_ROM_element(const size_t rom_id, const size_t index_value, const uint32_t value_witness)
+    {
+        set_ROM_element_pair(rom_id, index_value, { value_witness, zero_idx });
+    }
+
+    void set_ROM_element_pair(const size_t rom_id,
+                              const size_t index_value,
+                              const std::array<uint32_t, 2>& value_witnesses)
+    {
+        ASSERT(rom_arrays.size() > rom_id);
+        auto& rom_array = rom_arrays[rom_id];
+        ASSERT(rom_array.size() > index_value);
+        ASSERT(rom_array[index_value][0] == UNINITIALIZED_MEMORY_RECORD);
+        rom_array[index_value] = value_witnesses;
+    }
+
+    uint32_t read_ROM_array(const size_t rom_id, const uint32_t index_witness)
+    {
+        return read_ROM_array_pair(rom_id, index_witness)[0];
+    }
+
+    std::array<uint32_t, 2> read_ROM_array_pair(const size_t rom_id, const uint32_t index_witness)
+    {
+        ASSERT(rom_arrays.size() > rom_id);
+        const auto& rom_array = rom_arrays[rom_id];
+        const uint256_t index(get_variable(index_witness));
+        if (!check(index < rom_array.size() && rom_array[index.data[0]][0] != UNINITIALIZED_MEMORY_RECORD,
+                   "read_ROM_array: index out of bounds or uninitialized")) {
+            return { add_variable(FF::zero()), add_variable(FF::zero()) };
+        }
+        const auto& cell = rom_array[index.data[0]];
+        return { add_variable(get_variable(cell[0])), add_variable(get_variable(cell[1])) };
+    }
+
+    size_t create_RAM_array(const size_t array_size)
+    {
+        ram_arrays.emplace_back(array_size, UNINITIALIZED_MEMORY_RECORD);
+        return ram_arrays.size() - 1;
+    }
+
+    void init_RAM_element(const size_t ram_id, const size_t index_value, const uint32_t value_witness)
+    {
+        ASSERT(ram_arrays.size() > ram_id);
+        auto& ram_array = ram_arrays[ram_id];
+        ASSERT(ram_array.size() > index_value);
+        ASSERT(ram_array[index_value] == UNINITIALIZED_MEMORY_RECORD);
+        ram_array[index_value] = value_witness;
+    }
+
+    uint32_t read_RAM_array(const size_t ram_id, const uint32_t index_witness)
+    {
+        ASSERT(ram_arrays.size() > ram_id);
+        const auto& ram_array = ram_arrays[ram_id];
+        const uint256_t index(get_variable(index_witness));
+        if (!check(index < ram_array.size() && ram_array[index.data[0]] != UNINITIALIZED_MEMORY_RECORD,
+                   "read_RAM_array: index out of bounds or uninitialized")) {
+            return add_variable(FF::zero());
+        }
+        return add_variable(get_variable(ram_array[index.data[0]]));
+    }
+
+    void write_RAM_array(const size_t ram_id, const uint32_t index_witness, const uint32_t value_witness)
+    {
+        ASSERT(ram_arrays.size() > ram_id);
+        auto& ram_array = ram_arrays[ram_id];
+        const uint256_t index(get_variable(index_witness));
+        if (check(index < ram_array.size() && ram_array[index.data[0]] != UNINITIALIZED_MEMORY_RECORD,
+                  "write_RAM_array: index out of bounds or uninitialized")) {
+            ram_array[index.data[0]] = value_witness;
+        }
+    }
+
+    bool check_circuit() const { return !_failed; }
+
+    bool failed() const { return _failed; };
+    const std::string& err() const { return _err; };
+
+    void set_err(std::string msg) { _err = std::move(msg); }
+    void failure(std::string msg)
+    {
+        _failed = true;
+        set_err(std::move(msg));
+    }
+
+  private:
+    // Record the first violated constraint only, mirroring the way the real builders report failures
+    bool check(const bool satisfied, std::string const& msg)
+    {
+        if (!satisfied && !_failed) {
+            failure(msg);
+        }
+        return satisfied;
+    }
+
+    // Complete a pending gate that reads the 4th wire of the gate being created, whose 4th wire is w_4
+    void consume_next_gate_w_4(const uint32_t w_4)
+    {
+        if (next_gate_w_4_term.has_value()) {
+            check(next_gate_w_4_term.value() + get_variable(w_4) == FF::zero(), "create_big_add_gate");
+            next_gate_w_4_term.reset();
+        }
+    }
+
+    // Shared by addition and subtraction: z_i = x_i * x_scaling_i + sign * y_i * y_scaling_i + c_i on each limb
+    std::array<uint32_t, 5> evaluate_non_native_field_linear_combination(
+        const std::array<add_simple, 4>& limbs, const std::tuple<uint32_t, uint32_t, FF>& limbp, const FF& sign)
+    {
+        consume_next_gate_w_4(std::get<0>(limbp));
+        std::array<uint32_t, 5> result;
+        for (size_t i = 0; i < 4; ++i) {
+            const auto& [x, y, constant] = limbs[i];
+            result[i] =
+                add_variable(get_variable(x.first) * x.second + sign * get_variable(y.first) * y.second + constant);
+        }
+        result[4] = add_variable(get_variable(std::get<0>(limbp)) + sign * get_variable(std::get<1>(limbp)) +
+                                 std::get<2>(limbp));
+        return result;
+    }
+
+    std::vector<std::vector<std::array<uint32_t, 2>>> rom_arrays;
+    std::vector<std::vector<uint32_t>> ram_arrays;
+    std::optional<FF> next_gate_w_4_term;
+    bool _failed = false;
+    std::string _err;
+};
+
+} // namespace bb
@@ -455,31 +455,31 @@ template <typename Flavor> class ECCVMCircuitBuilder {
             polys.msm_slice4[i] = msm_state[i].add_state[3].slice;
         }
 
-        polys.transcript_mul_shift = Polynomial(polys.transcript_mul.shifted());
-        polys.transcript_msm_count_shift = Polynomial(polys.transcript_msm_count.shifted());
-        polys.transcript_accumulator_x_shift = Polynomial(polys.transcript_accumulator_x.shifted());
-        polys.transcript_accumulator_y_shift = Polynomial(polys.transcript_accumulator_y.shifted());
-        polys.precompute_scalar_sum_shift = Polynomial(polys.precompute_scalar_sum.shifted());
-        polys.precompute_s1hi_shift = Polynomial(polys.precompute_s1hi.shifted());
-        polys.precompute_dx_shift = Polynomial(polys.precompute_dx.shifted());
-        polys.precompute_dy_shift = Polynomial(polys.precompute_dy.shifted());
-        polys.precompute_tx_shift = Polynomial(polys.precompute_tx.shifted());
-        polys.precompute_ty_shift = Polynomial(polys.precompute_ty.shifted());
-        polys.msm_transition_shift = Polynomial(polys.msm_transition.shifted());
-        polys.msm_add_shift = Polynomial(polys.msm_add.shifted());
-        polys.msm_double_shift = Polynomial(polys.msm_double.shifted());
-        polys.msm_skew_shift = Polynomial(polys.msm_skew.shifted());
-        polys.msm_accumulator_x_shift = Polynomial(polys.msm_accumulator_x.shifted());
-        polys.msm_accumulator_y_shift = Polynomial(polys.msm_accumulator_y.shifted());
-        polys.msm_count_shift = Polynomial(polys.msm_count.shifted());
-        polys.msm_round_shift = Polynomial(polys.msm_round.shifted());
-        polys.msm_add1_shift = Polynomial(polys.msm_add1.shifted());
-        polys.msm_pc_shift = Polynomial(polys.msm_pc.shifted());
-        polys.precompute_pc_shift = Polynomial(polys.precompute_pc.shifted());
-        polys.transcript_pc_shift = Polynomial(polys.transcript_pc.shifted());
-        polys.precompute_round_shift = Polynomial(polys.precompute_round.shifted());
-        polys.transcript_accumulator_empty_shift = Polynomial(polys.transcript_accumulator_empty.shifted());
-        polys.precompute_select_shift = Polynomial(polys.precompute_select.shifted());
+        polys.transcript_mul_shift = polys.transcript_mul.shifted();
+        polys.transcript_msm_count_shift = polys.transcript_msm_count.shifted();
+        polys.transcript_accumulator_x_shift = polys.transcript_accumulator_x.shifted();
+        polys.transcript_accumulator_y_shift = polys.transcript_accumulator_y.shifted();
+        polys.precompute_scalar_sum_shift = polys.precompute_scalar_sum.shifted();
+        polys.precompute_s1hi_shift = polys.precompute_s1hi.shifted();
+        polys.precompute_dx_shift = polys.precompute_dx.shifted();
+        polys.precompute_dy_shift = polys.precompute_dy.shifted();
+        polys.precompute_tx_shift = polys.precompute_tx.shifted();
+        polys.precompute_ty_shift = polys.precompute_ty.shifted();
+        polys.msm_transition_shift = polys.msm_transition.shifted();
+        polys.msm_add_shift = polys.msm_add.shifted();
+        polys.msm_double_shift = polys.msm_double.shifted();
+        polys.msm_skew_shift = polys.msm_skew.shifted();
+        polys.msm_accumulator_x_shift = polys.msm_accumulator_x.shifted();
+        polys.msm_accumulator_y_shift = polys.msm_accumulator_y.shifted();
+        polys.msm_count_shift = polys.msm_count.shifted();
+        polys.msm_round_shift = polys.msm_round.shifted();
+        polys.msm_add1_shift = polys.msm_add1.shifted();
+        polys.msm_pc_shift = polys.msm_pc.shifted();
+        polys.precompute_pc_shift = polys.precompute_pc.shifted();
+        polys.transcript_pc_shift = polys.transcript_pc.shifted();
+        polys.precompute_round_shift = polys.precompute_round.shifted();
+        polys.transcript_accumulator_empty_shift = polys.transcript_accumulator_empty.shifted();
+        polys.precompute_select_shift = polys.precompute_select.shifted();
         return polys;
     }
 
@@ -508,7 +508,7 @@ template <typename Flavor> class ECCVMCircuitBuilder {
         compute_logderivative_inverse<Flavor, ECCVMLookupRelation<FF>>(polynomials, params, num_rows);
         compute_permutation_grand_product<Flavor, ECCVMSetRelation<FF>>(num_rows, polynomials, params);
 
-        polynomials.z_perm_shift = Polynomial(polynomials.z_perm.shifted());
+        polynomials.z_perm_shift = polynomials.z_perm.shifted();
 
         const auto evaluate_relation = [&]<typename Relation>(const std::string& relation_name) {
             typename Relation::SumcheckArrayOfValuesOverSubrelations result;
@@ -420,6 +420,17 @@ class GoblinTranslatorCircuitBuilder : public CircuitBuilderBase<bb::fr> {
         return result;
     }
 
+    /**
+     * @brief Compute the number of gates the builder will contain after being fed an op queue with the given number of
+     * operations
+     * @details Allows the size of the circuit to be known before the challenges needed to construct it are available.
+     * There is one initial zero row and each accumulation gate occupies 2 rows.
+     *
+     * @param num_ecc_ops The number of raw operations in the ECCOpQueue
+     * @return size_t
+     */
+    static size_t compute_num_gates(const size_t num_ecc_ops) { return 1 + 2 * num_ecc_ops; }
+
     /**
      * @brief Create a single accumulation gate
      *
@@ -61,24 +61,26 @@ void UltraCircuitBuilder_<Arithmetization>::add_gates_to_ensure_all_polys_are_no
 {
     // First add a gate to simultaneously ensure first entries of all wires is zero and to add a non
     // zero value to all selectors aside from q_c and q_lookup
-    blocks.main.populate_wires(this->zero_idx, this->zero_idx, this->zero_idx, this->zero_idx);
-    blocks.main.q_m().emplace_back(1);
-    blocks.main.q_1().emplace_back(1);
-    blocks.main.q_2().emplace_back(1);
-    blocks.main.q_3().emplace_back(1);
-    blocks.main.q_c().emplace_back(0);
-    blocks.main.q_sort().emplace_back(1);
+    if (!witness_only) {
+        blocks.main.populate_wires(this->zero_idx, this->zero_idx, this->zero_idx, this->zero_idx);
+        blocks.main.q_m().emplace_back(1);
+        blocks.main.q_1().emplace_back(1);
+        blocks.main.q_2().emplace_back(1);
+        blocks.main.q_3().emplace_back(1);
+        blocks.main.q_c().emplace_back(0);
+        blocks.main.q_sort().emplace_back(1);
 
-    blocks.main.q_arith().emplace_back(1);
-    blocks.main.q_4().emplace_back(1);
-    blocks.main.q_lookup_type().emplace_back(0);
-    blocks.main.q_elliptic().emplace_back(1);
-    blocks.main.q_aux().emplace_back(1);
-    if constexpr (HasAdditionalSelectors<Arithmetization>) {
-        blocks.main.pad_additional();
+        blocks.main.q_arith().emplace_back(1);
+        blocks.main.q_4().emplace_back(1);
+        blocks.main.q_lookup_type().emplace_back(0);
+        blocks.main.q_elliptic().emplace_back(1);
+        blocks.main.q_aux().emplace_back(1);
+        if constexpr (HasAdditionalSelectors<Arithmetization>) {
+            blocks.main.pad_additional();
+        }
+        check_selector_length_consistency();
+        ++this->num_gates;
     }
-    check_selector_length_consistency();
-    ++this->num_gates;
 
     // Some relations depend on wire shifts so we add another gate with
     // wires set to 0 to ensure corresponding constraints are satisfied
@@ -120,6 +122,9 @@ void UltraCircuitBuilder_<Arithmetization>::add_gates_to_ensure_all_polys_are_no
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_add_gate(const add_triple_<FF>& in)
 {
+    if (witness_only) {
+        return;
+    }
     this->assert_valid_variables({ in.a, in.b, in.c });
 
     blocks.main.populate_wires(in.a, in.b, in.c, this->zero_idx);
@@ -153,6 +158,9 @@ template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_big_add_gate(const add_quad_<FF>& in,
                                                                 const bool include_next_gate_w_4)
 {
+    if (witness_only) {
+        return;
+    }
     this->assert_valid_variables({ in.a, in.b, in.c, in.d });
     blocks.main.populate_wires(in.a, in.b, in.c, in.d);
     blocks.main.q_m().emplace_back(0);
@@ -246,6 +254,9 @@ void UltraCircuitBuilder_<Arithmetization>::create_big_add_gate_with_bit_extract
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_big_mul_gate(const mul_quad_<FF>& in)
 {
+    if (witness_only) {
+        return;
+    }
     this->assert_valid_variables({ in.a, in.b, in.c, in.d });
 
     blocks.main.populate_wires(in.a, in.b, in.c, in.d);
@@ -274,23 +285,25 @@ void UltraCircuitBuilder_<Arithmetization>::create_balanced_add_gate(const add_q
 {
     this->assert_valid_variables({ in.a, in.b, in.c, in.d });
 
-    blocks.main.populate_wires(in.a, in.b, in.c, in.d);
-    blocks.main.q_m().emplace_back(0);
-    blocks.main.q_1().emplace_back(in.a_scaling);
-    blocks.main.q_2().emplace_back(in.b_scaling);
-    blocks.main.q_3().emplace_back(in.c_scaling);
-    blocks.main.q_c().emplace_back(in.const_scaling);
-    blocks.main.q_arith().emplace_back(1);
-    blocks.main.q_4().emplace_back(in.d_scaling);
-    blocks.main.q_sort().emplace_back(0);
-    blocks.main.q_lookup_type().emplace_back(0);
-    blocks.main.q_elliptic().emplace_back(0);
-    blocks.main.q_aux().emplace_back(0);
-    if constexpr (HasAdditionalSelectors<Arithmetization>) {
-        blocks.main.pad_additional();
+    if (!witness_only) {
+        blocks.main.populate_wires(in.a, in.b, in.c, in.d);
+        blocks.main.q_m().emplace_back(0);
+        blocks.main.q_1().emplace_back(in.a_scaling);
+        blocks.main.q_2().emplace_back(in.b_scaling);
+        blocks.main.q_3().emplace_back(in.c_scaling);
+        blocks.main.q_c().emplace_back(in.const_scaling);
+        blocks.main.q_arith().emplace_back(1);
+        blocks.main.q_4().emplace_back(in.d_scaling);
+        blocks.main.q_sort().emplace_back(0);
+        blocks.main.q_lookup_type().emplace_back(0);
+        blocks.main.q_elliptic().emplace_back(0);
+        blocks.main.q_aux().emplace_back(0);
+        if constexpr (HasAdditionalSelectors<Arithmetization>) {
+            blocks.main.pad_additional();
+        }
+        check_selector_length_consistency();
+        ++this->num_gates;
     }
-    check_selector_length_consistency();
-    ++this->num_gates;
     // Why 3? TODO: return to this
     // The purpose of this gate is to do enable lazy 32-bit addition.
     // Consider a + b = c mod 2^32
@@ -314,6 +327,9 @@ void UltraCircuitBuilder_<Arithmetization>::create_balanced_add_gate(const add_q
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_mul_gate(const mul_triple_<FF>& in)
 {
+    if (witness_only) {
+        return;
+    }
     this->assert_valid_variables({ in.a, in.b, in.c });
 
     blocks.main.populate_wires(in.a, in.b, in.c, this->zero_idx);
@@ -342,6 +358,9 @@ void UltraCircuitBuilder_<Arithmetization>::create_mul_gate(const mul_triple_<FF
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_bool_gate(const uint32_t variable_index)
 {
+    if (witness_only) {
+        return;
+    }
     this->assert_valid_variables({ variable_index });
 
     blocks.main.populate_wires(variable_index, variable_index, this->zero_idx, this->zero_idx);
@@ -373,6 +392,9 @@ void UltraCircuitBuilder_<Arithmetization>::create_bool_gate(const uint32_t vari
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_poly_gate(const poly_triple_<FF>& in)
 {
+    if (witness_only) {
+        return;
+    }
     this->assert_valid_variables({ in.a, in.b, in.c });
 
     blocks.main.populate_wires(in.a, in.b, in.c, this->zero_idx);
@@ -406,6 +428,9 @@ void UltraCircuitBuilder_<Arithmetization>::create_poly_gate(const poly_triple_<
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_ecc_add_gate(const ecc_add_gate_<FF>& in)
 {
+    if (witness_only) {
+        return;
+    }
     /**
      * gate structure:
      * | 1  | 2  | 3  | 4  |
@@ -475,6 +500,9 @@ void UltraCircuitBuilder_<Arithmetization>::create_ecc_add_gate(const ecc_add_ga
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_ecc_dbl_gate(const ecc_dbl_gate_<FF>& in)
 {
+    if (witness_only) {
+        return;
+    }
     /**
      * gate structure:
      * | 1  | 2  | 3  | 4  |
@@ -542,6 +570,9 @@ void UltraCircuitBuilder_<Arithmetization>::create_ecc_dbl_gate(const ecc_dbl_ga
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::fix_witness(const uint32_t witness_index, const FF& witness_value)
 {
+    if (witness_only) {
+        return;
+    }
     this->assert_valid_variables({ witness_index });
 
     blocks.main.populate_wires(witness_index, this->zero_idx, this->zero_idx, this->zero_idx);
@@ -584,9 +615,10 @@ plookup::BasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const ploo
             return table;
         }
     }
-    // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
-    return lookup_tables[lookup_tables.size() - 1];
+    // Table doesn't exist! So copy it from the precomputed tables shared by all builders.
+    auto& table = lookup_tables.emplace_back(plookup::get_precomputed_basic_table(id));
+    table.table_index = lookup_tables.size() - 1;
+    return table;
 }
 
 /**
@@ -618,6 +650,9 @@ plookup::ReadData<uint32_t> UltraCircuitBuilder_<Arithmetization>::create_gates_
         read_data[plookup::ColumnIdx::C2].push_back(second_idx);
         read_data[plookup::ColumnIdx::C3].push_back(third_idx);
         this->assert_valid_variables({ first_idx, second_idx, third_idx });
+        if (witness_only) {
+            continue;
+        }
 
         blocks.main.q_lookup_type().emplace_back(FF(1));
         blocks.main.q_3().emplace_back(FF(table.table_index));
@@ -921,6 +956,9 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_sort_constraint(const std::vector<uint32_t>& variable_index)
 {
+    if (witness_only) {
+        return;
+    }
     constexpr size_t gate_width = NUM_WIRES;
     ASSERT(variable_index.size() % gate_width == 0);
     this->assert_valid_variables(variable_index);
@@ -963,6 +1001,9 @@ template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_dummy_gate(
     auto& block, const uint32_t& idx_1, const uint32_t& idx_2, const uint32_t& idx_3, const uint32_t& idx_4)
 {
+    if (witness_only) {
+        return;
+    }
     block.populate_wires(idx_1, idx_2, idx_3, idx_4);
     block.q_m().emplace_back(0);
     block.q_1().emplace_back(0);
@@ -987,6 +1028,9 @@ void UltraCircuitBuilder_<Arithmetization>::create_dummy_gate(
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_dummy_constraints(const std::vector<uint32_t>& variable_index)
 {
+    if (witness_only) {
+        return;
+    }
     std::vector<uint32_t> padded_list = variable_index;
     constexpr size_t gate_width = NUM_WIRES;
     const uint64_t padding = (gate_width - (padded_list.size() % gate_width)) % gate_width;
@@ -1006,6 +1050,9 @@ template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_sort_constraint_with_edges(
     const std::vector<uint32_t>& variable_index, const FF& start, const FF& end)
 {
+    if (witness_only) {
+        return;
+    }
     // Convenient to assume size is at least 8 (gate_width = 4) for separate gates for start and end conditions
     constexpr size_t gate_width = NUM_WIRES;
     ASSERT(variable_index.size() % gate_width == 0 && variable_index.size() > gate_width);
@@ -1194,6 +1241,9 @@ std::vector<uint32_t> UltraCircuitBuilder_<Arithmetization>::decompose_into_defa
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::apply_aux_selectors(const AUX_SELECTORS type)
 {
+    if (witness_only) {
+        return;
+    }
     blocks.main.q_aux().emplace_back(type == AUX_SELECTORS::NONE ? 0 : 1);
     blocks.main.q_sort().emplace_back(0);
     blocks.main.q_lookup_type().emplace_back(0);
@@ -1450,14 +1500,16 @@ void UltraCircuitBuilder_<Arithmetization>::range_constrain_two_limbs(const uint
     const std::array<uint32_t, 5> lo_sublimbs = get_sublimbs(lo_idx, lo_masks);
     const std::array<uint32_t, 5> hi_sublimbs = get_sublimbs(hi_idx, hi_masks);
 
-    blocks.main.populate_wires(lo_sublimbs[0], lo_sublimbs[1], lo_sublimbs[2], lo_idx);
-    blocks.main.populate_wires(lo_sublimbs[3], lo_sublimbs[4], hi_sublimbs[0], hi_sublimbs[1]);
-    blocks.main.populate_wires(hi_sublimbs[2], hi_sublimbs[3], hi_sublimbs[4], hi_idx);
+    if (!witness_only) {
+        blocks.main.populate_wires(lo_sublimbs[0], lo_sublimbs[1], lo_sublimbs[2], lo_idx);
+        blocks.main.populate_wires(lo_sublimbs[3], lo_sublimbs[4], hi_sublimbs[0], hi_sublimbs[1]);
+        blocks.main.populate_wires(hi_sublimbs[2], hi_sublimbs[3], hi_sublimbs[4], hi_idx);
 
-    apply_aux_selectors(AUX_SELECTORS::LIMB_ACCUMULATE_1);
-    apply_aux_selectors(AUX_SELECTORS::LIMB_ACCUMULATE_2);
-    apply_aux_selectors(AUX_SELECTORS::NONE);
-    this->num_gates += 3;
+        apply_aux_selectors(AUX_SELECTORS::LIMB_ACCUMULATE_1);
+        apply_aux_selectors(AUX_SELECTORS::LIMB_ACCUMULATE_2);
+        apply_aux_selectors(AUX_SELECTORS::NONE);
+        this->num_gates += 3;
+    }
 
     for (size_t i = 0; i < 5; i++) {
         if (lo_masks[i] != 0) {
@@ -1612,21 +1664,23 @@ std::array<uint32_t, 2> UltraCircuitBuilder_<Arithmetization>::evaluate_non_nati
                           0 },
                         true);
 
-    blocks.main.populate_wires(input.a[1], input.b[1], input.r[0], lo_0_idx);
-    apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_1);
-    ++this->num_gates;
+    if (!witness_only) {
+        blocks.main.populate_wires(input.a[1], input.b[1], input.r[0], lo_0_idx);
+        apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_1);
+        ++this->num_gates;
 
-    blocks.main.populate_wires(input.a[0], input.b[0], input.a[3], input.b[3]);
-    apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_2);
-    ++this->num_gates;
+        blocks.main.populate_wires(input.a[0], input.b[0], input.a[3], input.b[3]);
+        apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_2);
+        ++this->num_gates;
 
-    blocks.main.populate_wires(input.a[2], input.b[2], input.r[3], hi_0_idx);
-    apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_3);
-    ++this->num_gates;
+        blocks.main.populate_wires(input.a[2], input.b[2], input.r[3], hi_0_idx);
+        apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_3);
+        ++this->num_gates;
 
-    blocks.main.populate_wires(input.a[1], input.b[1], input.r[2], hi_1_idx);
-    apply_aux_selectors(AUX_SELECTORS::NONE);
-    ++this->num_gates;
+        blocks.main.populate_wires(input.a[1], input.b[1], input.r[2], hi_1_idx);
+        apply_aux_selectors(AUX_SELECTORS::NONE);
+        ++this->num_gates;
+    }
 
     /**
      * product gate 6
@@ -1684,6 +1738,9 @@ void UltraCircuitBuilder_<Arithmetization>::process_non_native_field_multiplicat
         }
     }
     cached_partial_non_native_field_multiplication::deduplicate(cached_partial_non_native_field_multiplications);
+    if (witness_only) {
+        return;
+    }
 
     // iterate over the cached items and create constraints
     for (const auto& input : cached_partial_non_native_field_multiplications) {
@@ -1817,6 +1874,9 @@ std::array<uint32_t, 5> UltraCircuitBuilder_<Arithmetization>::evaluate_non_nati
     const auto z_2 = this->add_variable(z_2value);
     const auto z_3 = this->add_variable(z_3value);
     const auto z_p = this->add_variable(z_pvalue);
+    if (witness_only) {
+        return { z_0, z_1, z_2, z_3, z_p };
+    }
 
     /**
      *   we want the following layout in program memory
@@ -1939,6 +1999,9 @@ std::array<uint32_t, 5> UltraCircuitBuilder_<Arithmetization>::evaluate_non_nati
     const auto z_2 = this->add_variable(z_2value);
     const auto z_3 = this->add_variable(z_3value);
     const auto z_p = this->add_variable(z_pvalue);
+    if (witness_only) {
+        return { z_0, z_1, z_2, z_3, z_p };
+    }
 
     /**
      *   we want the following layout in program memory
@@ -2025,6 +2088,9 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
 {
     // Record wire value can't yet be computed
     record.record_witness = this->add_variable(0);
+    if (witness_only) {
+        return;
+    }
     apply_aux_selectors(AUX_SELECTORS::ROM_READ);
     blocks.main.populate_wires(
         record.index_witness, record.value_column1_witness, record.value_column2_witness, record.record_witness);
@@ -2045,6 +2111,9 @@ template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_sorted_ROM_gate(RomRecord& record)
 {
     record.record_witness = this->add_variable(0);
+    if (witness_only) {
+        return;
+    }
     apply_aux_selectors(AUX_SELECTORS::ROM_CONSISTENCY_CHECK);
     blocks.main.populate_wires(
         record.index_witness, record.value_column1_witness, record.value_column2_witness, record.record_witness);
@@ -2090,6 +2159,9 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     // we will be applying copy constraints + set membership constraints.
     // Later on during proof construction we will compute the record wire value + assign it
     record.record_witness = this->add_variable(0);
+    if (witness_only) {
+        return;
+    }
     apply_aux_selectors(record.access_type == RamRecord::AccessType::READ ? AUX_SELECTORS::RAM_READ
                                                                           : AUX_SELECTORS::RAM_WRITE);
     blocks.main.populate_wires(
@@ -2112,6 +2184,9 @@ template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::create_sorted_RAM_gate(RamRecord& record)
 {
     record.record_witness = this->add_variable(0);
+    if (witness_only) {
+        return;
+    }
     apply_aux_selectors(AUX_SELECTORS::RAM_CONSISTENCY_CHECK);
     blocks.main.populate_wires(
         record.index_witness, record.timestamp_witness, record.value_witness, record.record_witness);
@@ -2623,11 +2698,13 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
 
         uint32_t timestamp_delta_witness = this->add_variable(timestamp_delta);
 
-        apply_aux_selectors(AUX_SELECTORS::RAM_TIMESTAMP_CHECK);
-        blocks.main.populate_wires(
-            current.index_witness, current.timestamp_witness, timestamp_delta_witness, this->zero_idx);
+        if (!witness_only) {
+            apply_aux_selectors(AUX_SELECTORS::RAM_TIMESTAMP_CHECK);
+            blocks.main.populate_wires(
+                current.index_witness, current.timestamp_witness, timestamp_delta_witness, this->zero_idx);
 
-        ++this->num_gates;
+            ++this->num_gates;
+        }
 
         // store timestamp offsets for later. Need to apply range checks to them, but calling
         // `create_new_range_constraint` can add gates. Would ruin the structure of our sorted timestamp list.
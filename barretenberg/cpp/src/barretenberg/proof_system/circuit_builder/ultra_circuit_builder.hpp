@@ -12,17 +12,6 @@
 
 namespace bb {
 
-template <typename FF> struct non_native_field_witnesses {
-    // first 4 array elements = limbs
-    // 5th element = prime basis limb
-    std::array<uint32_t, 5> a;
-    std::array<uint32_t, 5> b;
-    std::array<uint32_t, 5> q;
-    std::array<uint32_t, 5> r;
-    std::array<FF, 5> neg_modulus;
-    FF modulus;
-};
-
 using namespace bb;
 
 template <typename Arithmetization_>
@@ -309,6 +298,14 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
 
     bool circuit_finalized = false;
 
+    /**
+     * @brief When set, the gate construction methods only compute witness values: no wires or selectors are recorded.
+     * @details Used to re-solve the witness of a circuit whose structure has already been built once. Variables, copy
+     * constraints, range lists, lookup reads and ROM/RAM transcripts are still populated exactly as in a full
+     * construction, so that the variable indices of both runs coincide.
+     */
+    bool witness_only = false;
+
     void process_non_native_field_multiplications();
     UltraCircuitBuilder_(const size_t size_hint = 0)
         : CircuitBuilderBase<FF>(size_hint)
@@ -361,35 +358,39 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     UltraCircuitBuilder_(UltraCircuitBuilder_&& other)
         : CircuitBuilderBase<FF>(std::move(other))
     {
-        blocks = other.blocks;
-        constant_variable_indices = other.constant_variable_indices;
-
-        lookup_tables = other.lookup_tables;
-        lookup_multi_tables = other.lookup_multi_tables;
-        range_lists = other.range_lists;
-        ram_arrays = other.ram_arrays;
-        rom_arrays = other.rom_arrays;
-        memory_read_records = other.memory_read_records;
-        memory_write_records = other.memory_write_records;
-        cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
+        blocks = std::move(other.blocks);
+        constant_variable_indices = std::move(other.constant_variable_indices);
+
+        lookup_tables = std::move(other.lookup_tables);
+        lookup_multi_tables = std::move(other.lookup_multi_tables);
+        range_lists = std::move(other.range_lists);
+        ram_arrays = std::move(other.ram_arrays);
+        rom_arrays = std::move(other.rom_arrays);
+        memory_read_records = std::move(other.memory_read_records);
+        memory_write_records = std::move(other.memory_write_records);
+        cached_partial_non_native_field_multiplications =
+            std::move(other.cached_partial_non_native_field_multiplications);
         circuit_finalized = other.circuit_finalized;
+        witness_only = other.witness_only;
     };
     UltraCircuitBuilder_& operator=(const UltraCircuitBuilder_& other) = default;
     UltraCircuitBuilder_& operator=(UltraCircuitBuilder_&& other)
     {
         CircuitBuilderBase<FF>::operator=(std::move(other));
-        blocks = other.blocks;
-        constant_variable_indices = other.constant_variable_indices;
-
-        lookup_tables = other.lookup_tables;
-        lookup_multi_tables = other.lookup_multi_tables;
-        range_lists = other.range_lists;
-        ram_arrays = other.ram_arrays;
-        rom_arrays = other.rom_arrays;
-        memory_read_records = other.memory_read_records;
-        memory_write_records = other.memory_write_records;
-        cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
+        blocks = std::move(other.blocks);
+        constant_variable_indices = std::move(other.constant_variable_indices);
+
+        lookup_tables = std::move(other.lookup_tables);
+        lookup_multi_tables = std::move(other.lookup_multi_tables);
+        range_lists = std::move(other.range_lists);
+        ram_arrays = std::move(other.ram_arrays);
+        rom_arrays = std::move(other.rom_arrays);
+        memory_read_records = std::move(other.memory_read_records);
+        memory_write_records = std::move(other.memory_write_records);
+        cached_partial_non_native_field_multiplications =
+            std::move(other.cached_partial_non_native_field_multiplications);
         circuit_finalized = other.circuit_finalized;
+        witness_only = other.witness_only;
         return *this;
     };
     ~UltraCircuitBuilder_() override = default;
@@ -2,6 +2,7 @@
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/proof_system/polynomial_store/polynomial_store.hpp"
 
+#include <algorithm>
 #include <memory>
 
 namespace bb {
@@ -28,13 +29,12 @@ std::array<typename Flavor::Polynomial, 4> construct_lookup_table_polynomials(
     for (const auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
 
-        for (size_t i = 0; i < table.size; ++i) {
-            table_polynomials[0][offset] = table.column_1[i];
-            table_polynomials[1][offset] = table.column_2[i];
-            table_polynomials[2][offset] = table.column_3[i];
-            table_polynomials[3][offset] = table_index;
-            ++offset;
-        }
+        // The columns are contiguous arrays of field elements, so they are copied over wholesale
+        std::copy_n(table.column_1.begin(), table.size, table_polynomials[0].begin() + offset);
+        std::copy_n(table.column_2.begin(), table.size, table_polynomials[1].begin() + offset);
+        std::copy_n(table.column_3.begin(), table.size, table_polynomials[2].begin() + offset);
+        std::fill_n(table_polynomials[3].begin() + offset, table.size, table_index);
+        offset += table.size;
     }
     return table_polynomials;
 }
@@ -9,6 +9,7 @@
 
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
@@ -19,6 +20,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <limits>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -64,23 +67,55 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
     PermutationMapping(size_t circuit_size)
     {
         for (uint8_t col_idx = 0; col_idx < NUM_WIRES; ++col_idx) {
-            sigmas[col_idx].reserve(circuit_size);
+            sigmas[col_idx].resize(circuit_size);
             if constexpr (generalized) {
-                ids[col_idx].reserve(circuit_size);
+                ids[col_idx].resize(circuit_size);
             }
             // Initialize every element to point to itself
-            for (uint32_t row_idx = 0; row_idx < circuit_size; ++row_idx) {
-                permutation_subgroup_element self{ row_idx, col_idx };
-                sigmas[col_idx].emplace_back(self);
-                if constexpr (generalized) {
-                    ids[col_idx].emplace_back(self);
+            run_loop_in_parallel(circuit_size, [&](size_t start, size_t end) {
+                for (size_t row_idx = start; row_idx < end; ++row_idx) {
+                    permutation_subgroup_element self{ static_cast<uint32_t>(row_idx), col_idx };
+                    sigmas[col_idx][row_idx] = self;
+                    if constexpr (generalized) {
+                        ids[col_idx][row_idx] = self;
+                    }
                 }
-            }
+            });
         }
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of all variables of a circuit, stored contiguously in compressed sparse row layout
+ * @details The nodes of the cycle of variable i are nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1]. The layout is
+ * built with a counting sort: the size of every cycle is counted first, the sizes are turned into offsets and the nodes
+ * are then scattered into place. This takes two allocations in total rather than one per variable.
+ */
+struct CopyCycles {
+    std::vector<uint32_t> offsets;
+    std::vector<cycle_node> nodes;
+
+    CopyCycles() = default;
+
+    /**
+     * @brief Allocate space for cycles of the given sizes. The nodes themselves are left to be filled in by the caller.
+     */
+    explicit CopyCycles(std::span<const uint32_t> cycle_sizes)
+        : offsets(cycle_sizes.size() + 1)
+    {
+        offsets[0] = 0;
+        for (size_t i = 0; i < cycle_sizes.size(); ++i) {
+            offsets[i + 1] = offsets[i] + cycle_sizes[i];
+        }
+        nodes.resize(offsets.back());
+    }
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    std::span<const cycle_node> operator[](size_t idx) const
+    {
+        return { nodes.data() + offsets[idx], nodes.data() + offsets[idx + 1] };
+    }
+};
 
 namespace {
 /**
@@ -99,7 +134,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    std::vector<CyclicPermutation> wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -108,44 +143,58 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Represents the index of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    size_t cycle_index = 0;
-    for (auto& copy_cycle : wire_copy_cycles) {
-        for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
-            // Get the indices of the current node and next node in the cycle
-            cycle_node current_cycle_node = copy_cycle[node_idx];
-            // If current node is the last one in the cycle, then the next one is the first one
-            size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
-            cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
-            const auto current_row = current_cycle_node.gate_index;
-            const auto next_row = next_cycle_node.gate_index;
-
-            const auto current_column = current_cycle_node.wire_index;
-            const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
-            // Point current node to the next node
-            mapping.sigmas[current_column][current_row] = {
-                .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
-            };
-
-            if constexpr (generalized) {
-                bool first_node = (node_idx == 0);
-                bool last_node = (next_cycle_node_index == 0);
+    // Dense copy of the map tau from each tag to the tag it is paired with, so that lookups are a single array access
+    static constexpr uint32_t UNPAIRED_TAG = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> tau;
+    if constexpr (generalized) {
+        if (!circuit_constructor.tau.empty()) {
+            tau.resize(circuit_constructor.tau.rbegin()->first + 1, UNPAIRED_TAG);
+        }
+        for (const auto& [tag, paired_tag] : circuit_constructor.tau) {
+            tau[tag] = paired_tag;
+        }
+    }
 
-                if (first_node) {
-                    mapping.ids[current_column][current_row].is_tag = true;
-                    mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column][current_row].is_tag = true;
+    // Go through each cycle. Every position of the trace belongs to exactly one cycle, so cycles can be processed in
+    // parallel.
+    run_loop_in_parallel(wire_copy_cycles.size(), [&](size_t start, size_t end) {
+        for (size_t cycle_index = start; cycle_index < end; ++cycle_index) {
+            const std::span<const cycle_node> copy_cycle = wire_copy_cycles[cycle_index];
+            for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
+                // Get the indices of the current node and next node in the cycle
+                cycle_node current_cycle_node = copy_cycle[node_idx];
+                // If current node is the last one in the cycle, then the next one is the first one
+                size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
+                cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
+                const auto current_row = current_cycle_node.gate_index;
+                const auto next_row = next_cycle_node.gate_index;
+
+                const auto current_column = current_cycle_node.wire_index;
+                const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
+                // Point current node to the next node
+                mapping.sigmas[current_column][current_row] = {
+                    .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
+                };
 
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column][current_row].row_index =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+                if constexpr (generalized) {
+                    bool first_node = (node_idx == 0);
+                    bool last_node = (next_cycle_node_index == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column][current_row].is_tag = true;
+                        mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
+                    }
+                    if (last_node) {
+                        mapping.sigmas[current_column][current_row].is_tag = true;
+
+                        const uint32_t tag = real_variable_tags[cycle_index];
+                        ASSERT(tag < tau.size() && tau[tag] != UNPAIRED_TAG);
+                        mapping.sigmas[current_column][current_row].row_index = tau[tag];
+                    }
                 }
             }
         }
-        cycle_index++;
-    }
+    });
 
     // Add information about public inputs to the computation
     const auto num_public_inputs = static_cast<uint32_t>(circuit_constructor.public_inputs.size());
@@ -155,9 +204,9 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // The public inputs are placed at the top of the execution trace, potentially offset by a zero row.
     const size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
     size_t pub_input_offset = num_zero_rows;
-    // If Goblin, PI are further offset by number of ecc op gates
-    if constexpr (IsGoblinFlavor<Flavor>) {
-        pub_input_offset += circuit_constructor.num_ecc_op_gates;
+    if constexpr (IsHonkFlavor<Flavor>) {
+        // Set by the execution trace, which accounts for the ecc op gates of Goblin and for structured traces
+        pub_input_offset = proving_key->pub_inputs_offset;
     }
     for (size_t i = 0; i < num_public_inputs; ++i) {
         size_t idx = i + pub_input_offset;
@@ -316,16 +365,16 @@ void compute_plonk_permutation_lagrange_polynomials_from_mapping(
 }
 
 /**
- * @brief Compute the monomial and coset-fft version of each lagrange polynomial of the given label
+ * @brief Compute the monomial version of each lagrange polynomial of the given label
  *
- * @details For Plonk we need the monomial and coset form of the polynomials, so we retrieve the lagrange form from
- * polynomial cache, compute FFT versions and put them in the cache
+ * @details For Plonk we need the monomial form of the polynomials, so we retrieve the lagrange form from polynomial
+ * cache, compute the iFFT and put it in the cache. The prover computes the coset form it needs from the monomial form.
  *
  * @tparam program_width Number of wires
  * @param key Pointer to the proving key
  */
 template <size_t program_width>
-void compute_monomial_and_coset_fft_polynomials_from_lagrange(std::string label, plonk::proving_key* key)
+void compute_monomial_polynomials_from_lagrange(std::string label, plonk::proving_key* key)
 {
     for (size_t i = 0; i < program_width; ++i) {
         std::string index = std::to_string(i + 1);
@@ -338,12 +387,7 @@ void compute_monomial_and_coset_fft_polynomials_from_lagrange(std::string label,
         bb::polynomial_arithmetic::ifft(
             (bb::fr*)&sigma_polynomial_lagrange[0], &sigma_polynomial[0], key->small_domain);
 
-        // Compute permutation polynomial coset FFT form
-        bb::polynomial sigma_fft(sigma_polynomial, key->large_domain.size);
-        sigma_fft.coset_fft(key->large_domain);
-
         key->polynomial_store.put(prefix, sigma_polynomial.share());
-        key->polynomial_store.put(prefix + "_fft", sigma_fft.share());
     }
 }
 
@@ -375,18 +419,18 @@ template <typename Flavor> inline void compute_first_and_last_lagrange_polynomia
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              std::vector<CyclicPermutation> copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraPlonkFlavor<Flavor> || IsUltraFlavor<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
 
     if constexpr (IsPlonkFlavor<Flavor>) { // any Plonk flavor
-        // Compute Plonk-style sigma and ID polynomials in lagrange, monomial, and coset-fft forms
+        // Compute Plonk-style sigma and ID polynomials in lagrange and monomial forms
         compute_plonk_permutation_lagrange_polynomials_from_mapping("sigma", mapping.sigmas, key);
-        compute_monomial_and_coset_fft_polynomials_from_lagrange<Flavor::NUM_WIRES>("sigma", key);
+        compute_monomial_polynomials_from_lagrange<Flavor::NUM_WIRES>("sigma", key);
         if constexpr (generalized) {
             compute_plonk_permutation_lagrange_polynomials_from_mapping("id", mapping.ids, key);
-            compute_monomial_and_coset_fft_polynomials_from_lagrange<Flavor::NUM_WIRES>("id", key);
+            compute_monomial_polynomials_from_lagrange<Flavor::NUM_WIRES>("id", key);
         }
     } else if constexpr (IsUltraFlavor<Flavor>) { // any UltraHonk flavor
         // Compute Honk-style sigma and ID polynomials from the corresponding mappings
@@ -84,3 +84,18 @@ TEST_F(PermutationHelperTests, ComputeStandardAuxPolynomials)
     // TODO(#425) Flesh out these tests
     compute_first_and_last_lagrange_polynomials<Flavor>(proving_key);
 }
+
+TEST_F(PermutationHelperTests, CopyCyclesLayout)
+{
+    std::vector<uint32_t> cycle_sizes{ 2, 0, 3, 1 };
+    CopyCycles copy_cycles(cycle_sizes);
+
+    EXPECT_EQ(copy_cycles.size(), cycle_sizes.size());
+    EXPECT_EQ(copy_cycles.nodes.size(), 6);
+    for (size_t i = 0; i < cycle_sizes.size(); ++i) {
+        EXPECT_EQ(copy_cycles[i].size(), cycle_sizes[i]);
+    }
+    // Cycles are laid out one after the other
+    EXPECT_EQ(copy_cycles[2].data(), copy_cycles.nodes.data() + 2);
+    EXPECT_EQ(copy_cycles[3].data(), copy_cycles.nodes.data() + 5);
+}
@@ -12,10 +12,14 @@ void ExecutionTrace_<Flavor>::populate(Builder& builder,
     // Construct wire polynomials, selector polynomials, and copy cycles from raw circuit data
     auto trace_data = construct_trace_data(builder, proving_key->circuit_size);
 
+    if constexpr (IsHonkFlavor<Flavor>) {
+        proving_key->pub_inputs_offset = trace_data.pub_inputs_offset;
+    }
+
     add_wires_and_selectors_to_proving_key(trace_data, builder, proving_key);
 
     if constexpr (IsUltraPlonkOrHonk<Flavor>) {
-        add_memory_records_to_proving_key(trace_data, builder, proving_key);
+        add_memory_records_to_proving_key(trace_data.ram_rom_offset, builder, proving_key);
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
@@ -26,6 +30,39 @@ void ExecutionTrace_<Flavor>::populate(Builder& builder,
     compute_permutation_argument_polynomials<Flavor>(builder, proving_key.get(), trace_data.copy_cycles);
 }
 
+template <class Flavor>
+void ExecutionTrace_<Flavor>::populate_wires(Builder& builder,
+                                             const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
+    requires IsHonkFlavor<Flavor>
+{
+    populate_public_inputs_block(builder);
+
+    const bool structured = is_structured(builder);
+    uint32_t offset = Flavor::has_zero_row ? 1 : 0;
+    uint32_t ram_rom_offset = 0;
+    for (auto& block : builder.blocks.get()) {
+        auto block_size = static_cast<uint32_t>(block.size());
+        for (auto [wire_poly, wire] : zip_view(proving_key->get_wires(), block.wires)) {
+            for (uint32_t row_idx = 0; row_idx < block_size; ++row_idx) {
+                wire_poly[row_idx + offset] = builder.get_variable(wire[row_idx]);
+            }
+        }
+        if (block.has_ram_rom) {
+            ram_rom_offset = offset;
+        }
+        if (&block == &builder.blocks.pub_inputs) {
+            proving_key->pub_inputs_offset = offset;
+        }
+        offset += get_block_trace_size(block, structured);
+    }
+
+    add_memory_records_to_proving_key(ram_rom_offset, builder, proving_key);
+
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        add_ecc_op_wires_to_proving_key(builder, proving_key);
+    }
+}
+
 template <class Flavor>
 void ExecutionTrace_<Flavor>::add_wires_and_selectors_to_proving_key(
     TraceData& trace_data, Builder& builder, const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
@@ -51,17 +88,17 @@ void ExecutionTrace_<Flavor>::add_wires_and_selectors_to_proving_key(
 
 template <class Flavor>
 void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(
-    TraceData& trace_data, Builder& builder, const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
+    uint32_t ram_rom_offset, Builder& builder, const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
     requires IsUltraPlonkOrHonk<Flavor>
 {
     ASSERT(proving_key->memory_read_records.empty() && proving_key->memory_write_records.empty());
 
     // Update indices of RAM/ROM reads/writes based on where block containing these gates sits in the trace
     for (auto& index : builder.memory_read_records) {
-        proving_key->memory_read_records.emplace_back(index + trace_data.ram_rom_offset);
+        proving_key->memory_read_records.emplace_back(index + ram_rom_offset);
     }
     for (auto& index : builder.memory_write_records) {
-        proving_key->memory_write_records.emplace_back(index + trace_data.ram_rom_offset);
+        proving_key->memory_write_records.emplace_back(index + ram_rom_offset);
     }
 }
 
@@ -69,11 +106,26 @@ template <class Flavor>
 typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_trace_data(Builder& builder,
                                                                                           size_t dyadic_circuit_size)
 {
-    TraceData trace_data{ dyadic_circuit_size, builder };
+    TraceData trace_data{ dyadic_circuit_size };
 
     // Complete the public inputs execution trace block from builder.public_inputs
     populate_public_inputs_block(builder);
 
+    // Count the number of appearances of each variable in the trace to lay out the copy cycles contiguously
+    std::vector<uint32_t> cycle_sizes(builder.variables.size(), 0);
+    for (auto& block : builder.blocks.get()) {
+        for (auto& wire : block.wires) {
+            for (const uint32_t var_idx : wire) {
+                ++cycle_sizes[builder.real_variable_index[var_idx]];
+            }
+        }
+    }
+    trace_data.copy_cycles = CopyCycles(cycle_sizes);
+    // Position in copy_cycles.nodes at which the next node of the cycle of each variable is placed
+    std::vector<uint32_t> next_cycle_node(trace_data.copy_cycles.offsets.begin(),
+                                          trace_data.copy_cycles.offsets.end() - 1);
+
+    const bool structured = is_structured(builder);
     uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
     // For each block in the trace, populate wire polys, copy cycles and selector polys
     for (auto& block : builder.blocks.get()) {
@@ -89,7 +141,7 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
                 // Insert the real witness values from this block into the wire polys at the correct offset
                 trace_data.wires[wire_idx][trace_row_idx] = builder.get_variable(var_idx);
                 // Add the address of the witness value to its corresponding copy cycle
-                trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
+                trace_data.copy_cycles.nodes[next_cycle_node[real_var_idx]++] = cycle_node{ wire_idx, trace_row_idx };
             }
         }
 
@@ -106,8 +158,12 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
         if (block.has_ram_rom) {
             trace_data.ram_rom_offset = offset;
         }
+        if (&block == &builder.blocks.pub_inputs) {
+            trace_data.pub_inputs_offset = offset;
+        }
 
-        offset += block_size;
+        // In a structured trace, the next block starts at a fixed offset regardless of the size of this one
+        offset += get_block_trace_size(block, structured);
     }
     return trace_data;
 }
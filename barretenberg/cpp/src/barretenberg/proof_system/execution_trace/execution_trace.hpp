@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/proof_system/composer/permutation_lib.hpp"
 #include "barretenberg/srs/global_crs.hpp"
@@ -19,12 +20,14 @@ template <class Flavor> class ExecutionTrace_ {
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, Builder::Arithmetization::NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // For each variable, the set of addresses into the wire polynomials whose values are copy constrained
+        CopyCycles copy_cycles;
         // The starting index in the trace of the block containing RAM/RAM read/write gates
         uint32_t ram_rom_offset = 0;
+        // The starting index in the trace of the public inputs block
+        uint32_t pub_inputs_offset = 0;
 
-        TraceData(size_t dyadic_circuit_size, Builder& builder)
+        TraceData(size_t dyadic_circuit_size)
         {
             // Initializate the wire and selector polynomials
             for (auto& wire : wires) {
@@ -33,7 +36,6 @@ template <class Flavor> class ExecutionTrace_ {
             for (auto& selector : selectors) {
                 selector = Polynomial(dyadic_circuit_size);
             }
-            copy_cycles.resize(builder.variables.size());
         }
     };
 
@@ -44,7 +46,45 @@ template <class Flavor> class ExecutionTrace_ {
      */
     static void populate(Builder& builder, const std::shared_ptr<ProvingKey>&);
 
+    /**
+     * @brief Given a circuit, populate a proving key with the witness-dependent part of the trace only
+     * @details Adds the wire polynomials, the memory records and, for goblin flavors, the ecc op wires. Used when the
+     * selector and sigma/id polynomials of a structurally identical circuit are already available.
+     *
+     * @param builder
+     */
+    static void populate_wires(Builder& builder, const std::shared_ptr<ProvingKey>&)
+        requires IsHonkFlavor<Flavor>;
+
   private:
+    /**
+     * @brief Whether the blocks of the circuit are to be placed at fixed offsets, given by their fixed sizes
+     * @note Structured traces are only supported by Honk
+     */
+    static bool is_structured(Builder& builder)
+    {
+        if constexpr (IsHonkFlavor<Flavor>) {
+            return builder.blocks.is_structured();
+        }
+        return false;
+    }
+
+    /**
+     * @brief The number of rows occupied by a block in the trace: its fixed size if the trace is structured, its actual
+     * size otherwise
+     */
+    static uint32_t get_block_trace_size(auto& block, const bool is_structured)
+    {
+        const auto block_size = static_cast<uint32_t>(block.size());
+        if (!is_structured) {
+            return block_size;
+        }
+        if (block_size > block.fixed_size) {
+            throw_or_abort("Execution trace block exceeds its fixed size in the structured trace.");
+        }
+        return block.fixed_size;
+    }
+
     /**
      * @brief Add the wire and selector polynomials from the trace data to a honk or plonk proving key
      *
@@ -64,11 +104,11 @@ template <class Flavor> class ExecutionTrace_ {
      * within the block containing them. To obtain the row index in the trace at large, we simply increment these
      * indices by the offset at which that block is placed into the trace.
      *
-     * @param trace_data
+     * @param ram_rom_offset
      * @param builder
      * @param proving_key
      */
-    static void add_memory_records_to_proving_key(TraceData& trace_data,
+    static void add_memory_records_to_proving_key(uint32_t ram_rom_offset,
                                                   Builder& builder,
                                                   const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
         requires IsUltraPlonkOrHonk<Flavor>;
@@ -5,142 +5,152 @@
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include <tuple>
 #include <typeinfo>
 
 namespace bb {
 
-// TODO(luke): This contains utilities for grand product computation and is not specific to the permutation grand
-// product. Update comments accordingly.
 /**
- * @brief Compute a permutation grand product polynomial Z_perm(X)
- * *
- * @details
- * Z_perm may be defined in terms of its values  on X_i = 0,1,...,n-1 as Z_perm[0] = 1 and for i = 1:n-1
- *                  relation::numerator(j)
- * Z_perm[i] = ∏ --------------------------------------------------------------------------------
- *                  relation::denominator(j)
- *
- * where ∏ := ∏_{j=0:i-1}
- *
- * The specific algebraic relation used by Z_perm is defined by Flavor::GrandProductRelations
- *
- * For example, in Flavor::Standard the relation describes:
+ * @brief Compute a grand product polynomial Z(X) from the numerator and denominator terms of each row
  *
- *                  (w_1(j) + β⋅id_1(j) + γ) ⋅ (w_2(j) + β⋅id_2(j) + γ) ⋅ (w_3(j) + β⋅id_3(j) + γ)
- * Z_perm[i] = ∏ --------------------------------------------------------------------------------
- *                  (w_1(j) + β⋅σ_1(j) + γ) ⋅ (w_2(j) + β⋅σ_2(j) + γ) ⋅ (w_3(j) + β⋅σ_3(j) + γ)
- * where ∏ := ∏_{j=0:i-1} and id_i(X) = id(X) + n*(i-1)
+ * @details Z is defined by its values on X_i = 0,1,...,n-1 as Z[0] = 0 and for i = 1:n-1
  *
- * For Flavor::Ultra both the UltraPermutation and Lookup grand products are computed by this method.
+ *                A(j)
+ * Z[i] = ∏ ------
+ *                B(j)
  *
- * The grand product is constructed over the course of three steps.
+ * where ∏ := ∏_{j=0:i-1} and compute_row_terms maps the evaluations of all polynomials at row j to the pair (A(j), B(j)).
  *
- * For expositional simplicity, write Z_perm[i] as
+ * The rows are split into one block per thread and the grand product is constructed in three steps:
  *
- *                A(j)
- * Z_perm[i] = ∏ --------------------------
- *                B(h)
+ * Step 1) Each thread traverses its block in chunks small enough to stay in cache. For each chunk it computes A(j) and
+ *         B(j), batch inverts the B(j) and writes the running product of the ratios A(j)/B(j) over its block directly
+ *         into Z
+ * Step 2) Serially, compute for each block the product of the ratios of all the blocks preceding it
+ * Step 3) Each thread scales the running products of its block by that factor
  *
- * Step 1) Compute 2 length-n polynomials A, B
- * Step 2) Compute 2 length-n polynomials numerator = ∏ A(j), nenominator = ∏ B(j)
- * Step 3) Compute Z_perm[i + 1] = numerator[i] / denominator[i] (recall: Z_perm[0] = 1)
+ * No circuit-sized scratch space is needed and the batch inversion only costs one inversion per chunk.
  *
- * Note: Step (3) utilizes Montgomery batch inversion to replace n-many inversions with
+ * @param circuit_size
+ * @param full_polynomials The polynomials the row terms are computed from
+ * @param grand_product_polynomial The polynomial Z to populate
+ * @param compute_row_terms Callable mapping a Flavor::AllValues to the pair (A(j), B(j))
  */
-template <typename Flavor, typename GrandProdRelation>
-void compute_grand_product(const size_t circuit_size,
-                           typename Flavor::ProverPolynomials& full_polynomials,
-                           bb::RelationParameters<typename Flavor::FF>& relation_parameters)
+template <typename Flavor>
+void compute_grand_product_from_row_terms(const size_t circuit_size,
+                                          auto& full_polynomials,
+                                          auto& grand_product_polynomial,
+                                          const auto& compute_row_terms)
 {
     using FF = typename Flavor::FF;
-    using Polynomial = typename Flavor::Polynomial;
-    using Accumulator = std::tuple_element_t<0, typename GrandProdRelation::SumcheckArrayOfValuesOverSubrelations>;
 
-    // Allocate numerator/denominator polynomials that will serve as scratch space
-    // TODO(zac) we can re-use the permutation polynomial as the numerator polynomial. Reduces readability
-    Polynomial numerator{ circuit_size };
-    Polynomial denominator{ circuit_size };
+    // Number of rows whose numerator/denominator terms are computed and inverted at once
+    static constexpr size_t CHUNK_SIZE = 1 << 10;
+    static constexpr size_t MIN_CIRCUIT_SIZE_TO_MULTITHREAD = 64;
 
-    // Step (1)
-    // Populate `numerator` and `denominator` with the algebra described by Relation
-    const size_t num_threads = circuit_size >= get_num_cpus_pow2() ? get_num_cpus_pow2() : 1;
+    grand_product_polynomial[0] = 0;
+
+    // The terms of row i determine Z[i + 1], so those of the last row are not needed
+    const size_t num_rows = circuit_size - 1;
+    const size_t num_threads = circuit_size >= MIN_CIRCUIT_SIZE_TO_MULTITHREAD
+                                   ? (circuit_size >= get_num_cpus_pow2() ? get_num_cpus_pow2() : 1)
+                                   : 1;
     const size_t block_size = circuit_size / num_threads;
     auto full_polynomials_view = full_polynomials.get_all();
+
+    // Step (1)
+    std::vector<FF> block_products(num_threads);
     parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
+        const size_t end = (thread_idx == num_threads - 1) ? num_rows : (thread_idx + 1) * block_size;
         typename Flavor::AllValues evaluations;
         auto evaluations_view = evaluations.get_all();
-        for (size_t i = start; i < end; ++i) {
-            for (auto [eval, full_poly] : zip_view(evaluations_view, full_polynomials_view)) {
-                eval = full_poly.size() > i ? full_poly[i] : 0;
+        std::vector<FF> numerator(std::min(CHUNK_SIZE, block_size));
+        std::vector<FF> denominator(numerator.size());
+
+        FF running_product = 1;
+        for (size_t chunk_start = start; chunk_start < end; chunk_start += CHUNK_SIZE) {
+            const size_t chunk_size = std::min(CHUNK_SIZE, end - chunk_start);
+            for (size_t k = 0; k < chunk_size; ++k) {
+                const size_t i = chunk_start + k;
+                for (auto [eval, full_poly] : zip_view(evaluations_view, full_polynomials_view)) {
+                    eval = full_poly.size() > i ? full_poly[i] : 0;
+                }
+                std::tie(numerator[k], denominator[k]) = compute_row_terms(evaluations);
+            }
+            FF::batch_invert(std::span{ denominator.data(), chunk_size });
+            for (size_t k = 0; k < chunk_size; ++k) {
+                running_product *= numerator[k] * denominator[k];
+                grand_product_polynomial[chunk_start + k + 1] = running_product;
             }
-            numerator[i] = GrandProdRelation::template compute_grand_product_numerator<Accumulator>(
-                evaluations, relation_parameters);
-            denominator[i] = GrandProdRelation::template compute_grand_product_denominator<Accumulator>(
-                evaluations, relation_parameters);
         }
+        block_products[thread_idx] = running_product;
     });
 
     // Step (2)
-    // Compute the accumulating product of the numerator and denominator terms.
-    // This step is split into three parts for efficient multithreading:
-    // (i) compute ∏ A(j), ∏ B(j) subproducts for each thread
-    // (ii) compute scaling factor required to convert each subproduct into a single running product
-    // (ii) combine subproducts into a single running product
-    //
-    // For example, consider 4 threads and a size-8 numerator { a0, a1, a2, a3, a4, a5, a6, a7 }
-    // (i)   Each thread computes 1 element of N = {{ a0, a0a1 }, { a2, a2a3 }, { a4, a4a5 }, { a6, a6a7 }}
-    // (ii)  Take partial products P = { 1, a0a1, a2a3, a4a5 }
-    // (iii) Each thread j computes N[i][j]*P[j]=
-    //      {{a0,a0a1},{a0a1a2,a0a1a2a3},{a0a1a2a3a4,a0a1a2a3a4a5},{a0a1a2a3a4a5a6,a0a1a2a3a4a5a6a7}}
-    std::vector<FF> partial_numerators(num_threads);
-    std::vector<FF> partial_denominators(num_threads);
-
-    parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end - 1; ++i) {
-            numerator[i + 1] *= numerator[i];
-            denominator[i + 1] *= denominator[i];
-        }
-        partial_numerators[thread_idx] = numerator[end - 1];
-        partial_denominators[thread_idx] = denominator[end - 1];
-    });
+    // Replace the product of each block by the product of all blocks preceding it. For example, with 4 threads and
+    // block products { P0, P1, P2, P3 } this yields the scaling factors { 1, P0, P0P1, P0P1P2 }
+    FF preceding_product = 1;
+    for (auto& block_product : block_products) {
+        const FF product = block_product;
+        block_product = preceding_product;
+        preceding_product *= product;
+    }
 
+    // Step (3)
     parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
-        if (thread_idx > 0) {
-            FF numerator_scaling = 1;
-            FF denominator_scaling = 1;
-
-            for (size_t j = 0; j < thread_idx; ++j) {
-                numerator_scaling *= partial_numerators[j];
-                denominator_scaling *= partial_denominators[j];
-            }
-            for (size_t i = start; i < end; ++i) {
-                numerator[i] *= numerator_scaling;
-                denominator[i] *= denominator_scaling;
-            }
+        if (thread_idx == 0) {
+            return;
         }
-
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator[start], block_size });
-    });
-
-    // Step (3) Compute z_perm[i] = numerator[i] / denominator[i]
-    auto& grand_product_polynomial = GrandProdRelation::get_grand_product_polynomial(full_polynomials);
-    grand_product_polynomial[0] = 0;
-    parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx == num_threads - 1) ? circuit_size - 1 : (thread_idx + 1) * block_size;
+        const size_t end = (thread_idx == num_threads - 1) ? num_rows : (thread_idx + 1) * block_size;
         for (size_t i = start; i < end; ++i) {
-            grand_product_polynomial[i + 1] = numerator[i] * denominator[i];
+            grand_product_polynomial[i + 1] *= block_products[thread_idx];
         }
     });
 }
 
+/**
+ * @brief Compute a permutation grand product polynomial Z_perm(X)
+ * *
+ * @details
+ * Z_perm may be defined in terms of its values  on X_i = 0,1,...,n-1 as Z_perm[0] = 1 and for i = 1:n-1
+ *                  relation::numerator(j)
+ * Z_perm[i] = ∏ --------------------------------------------------------------------------------
+ *                  relation::denominator(j)
+ *
+ * where ∏ := ∏_{j=0:i-1}
+ *
+ * The specific algebraic relation used by Z_perm is defined by Flavor::GrandProductRelations
+ *
+ * For example, in Flavor::Standard the relation describes:
+ *
+ *                  (w_1(j) + β⋅id_1(j) + γ) ⋅ (w_2(j) + β⋅id_2(j) + γ) ⋅ (w_3(j) + β⋅id_3(j) + γ)
+ * Z_perm[i] = ∏ --------------------------------------------------------------------------------
+ *                  (w_1(j) + β⋅σ_1(j) + γ) ⋅ (w_2(j) + β⋅σ_2(j) + γ) ⋅ (w_3(j) + β⋅σ_3(j) + γ)
+ * where ∏ := ∏_{j=0:i-1} and id_i(X) = id(X) + n*(i-1)
+ *
+ * For Flavor::Ultra both the UltraPermutation and Lookup grand products are computed by this method.
+ */
+template <typename Flavor, typename GrandProdRelation>
+void compute_grand_product(const size_t circuit_size,
+                           typename Flavor::ProverPolynomials& full_polynomials,
+                           bb::RelationParameters<typename Flavor::FF>& relation_parameters)
+{
+    using Accumulator = std::tuple_element_t<0, typename GrandProdRelation::SumcheckArrayOfValuesOverSubrelations>;
+
+    compute_grand_product_from_row_terms<Flavor>(
+        circuit_size,
+        full_polynomials,
+        GrandProdRelation::get_grand_product_polynomial(full_polynomials),
+        [&](const typename Flavor::AllValues& evaluations) {
+            return std::pair{ GrandProdRelation::template compute_grand_product_numerator<Accumulator>(
+                                  evaluations, relation_parameters),
+                              GrandProdRelation::template compute_grand_product_denominator<Accumulator>(
+                                  evaluations, relation_parameters) };
+        });
+}
+
 template <typename Flavor>
 void compute_grand_products(std::shared_ptr<typename Flavor::ProvingKey>& key,
                             typename Flavor::ProverPolynomials& full_polynomials,
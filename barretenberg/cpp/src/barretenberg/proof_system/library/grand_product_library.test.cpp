@@ -45,10 +45,9 @@ template <class FF> class GrandProductTests : public testing::Test {
      * @note This test does confirm the correctness of z_permutation, only that the two implementations yield an
      * identical result.
      */
-    template <typename Flavor> static void test_permutation_grand_product_construction()
+    template <typename Flavor, size_t num_gates> static void test_permutation_grand_product_construction()
     {
         // Define some mock inputs for proving key constructor
-        static const size_t num_gates = 8;
         static const size_t num_public_inputs = 0;
 
         // Instatiate a proving_key and make a pointer to it. This will be used to instantiate a Prover.
@@ -339,7 +338,13 @@ TYPED_TEST_SUITE(GrandProductTests, FieldTypes);
 
 TYPED_TEST(GrandProductTests, GrandProductPermutation)
 {
-    TestFixture::template test_permutation_grand_product_construction<UltraFlavor>();
+    TestFixture::template test_permutation_grand_product_construction<UltraFlavor, 8>();
+}
+
+// The grand product is computed in chunks of rows, make sure their running products are chained correctly
+TYPED_TEST(GrandProductTests, GrandProductPermutationMultipleChunks)
+{
+    TestFixture::template test_permutation_grand_product_construction<UltraFlavor, 1 << 11>();
 }
 
 TYPED_TEST(GrandProductTests, GrandProductLookup)
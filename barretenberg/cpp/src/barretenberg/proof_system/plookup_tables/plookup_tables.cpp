@@ -1,122 +1,277 @@
 #include "plookup_tables.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include <cstdlib>
+#include <fstream>
 #include <mutex>
+#ifndef __wasm__
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 namespace bb::plookup {
 
 using namespace bb;
 
 namespace {
-// TODO(@zac-williamson) convert these into static const members of a struct
+using MultiTables = std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES>;
+
+// Bump whenever the contents of any basic table change, so that stale cache files are ignored
+constexpr uint32_t BASIC_TABLE_CACHE_VERSION = 1;
+
+std::string default_basic_table_cache_dir()
+{
+    const char* dir = std::getenv("BB_LOOKUP_TABLE_CACHE_DIR");
+    return dir != nullptr ? dir : "";
+}
+
+// Basic tables are generated (or loaded from disk) at most once per process and never modified afterwards
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
+std::array<std::unique_ptr<const BasicTable>, BasicTableId::NUM_BASIC_TABLES> BASIC_TABLES;
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool initialised = false;
+std::array<std::once_flag, BasicTableId::NUM_BASIC_TABLES> basic_table_once_flags;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::string basic_table_cache_dir = default_basic_table_cache_dir();
 #ifndef NO_MULTITHREADING
-
-// The multitables initialisation procedure is not thread-sage, so we need to make sure only 1 thread gets to initialize
-// them.
-std::mutex multi_table_mutex;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex basic_table_cache_dir_mutex;
 #endif
-void init_multi_tables()
+
+std::string get_basic_table_cache_dir()
 {
 #ifndef NO_MULTITHREADING
-    std::unique_lock<std::mutex> lock(multi_table_mutex);
+    std::unique_lock<std::mutex> lock(basic_table_cache_dir_mutex);
 #endif
-    if (initialised) {
-        return;
-    }
-    MULTI_TABLES[MultiTableId::SHA256_CH_INPUT] = sha256_tables::get_choose_input_table(MultiTableId::SHA256_CH_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_MAJ_INPUT] =
+    return basic_table_cache_dir;
+}
+
+MultiTables init_multi_tables()
+{
+    MultiTables multi_tables;
+    multi_tables[MultiTableId::SHA256_CH_INPUT] = sha256_tables::get_choose_input_table(MultiTableId::SHA256_CH_INPUT);
+    multi_tables[MultiTableId::SHA256_MAJ_INPUT] =
         sha256_tables::get_majority_input_table(MultiTableId::SHA256_MAJ_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_WITNESS_INPUT] =
+    multi_tables[MultiTableId::SHA256_WITNESS_INPUT] =
         sha256_tables::get_witness_extension_input_table(MultiTableId::SHA256_WITNESS_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_CH_OUTPUT] =
+    multi_tables[MultiTableId::SHA256_CH_OUTPUT] =
         sha256_tables::get_choose_output_table(MultiTableId::SHA256_CH_OUTPUT);
-    MULTI_TABLES[MultiTableId::SHA256_MAJ_OUTPUT] =
+    multi_tables[MultiTableId::SHA256_MAJ_OUTPUT] =
         sha256_tables::get_majority_output_table(MultiTableId::SHA256_MAJ_OUTPUT);
-    MULTI_TABLES[MultiTableId::SHA256_WITNESS_OUTPUT] =
+    multi_tables[MultiTableId::SHA256_WITNESS_OUTPUT] =
         sha256_tables::get_witness_extension_output_table(MultiTableId::SHA256_WITNESS_OUTPUT);
-    MULTI_TABLES[MultiTableId::AES_NORMALIZE] = aes128_tables::get_aes_normalization_table(MultiTableId::AES_NORMALIZE);
-    MULTI_TABLES[MultiTableId::AES_INPUT] = aes128_tables::get_aes_input_table(MultiTableId::AES_INPUT);
-    MULTI_TABLES[MultiTableId::AES_SBOX] = aes128_tables::get_aes_sbox_table(MultiTableId::AES_SBOX);
-    MULTI_TABLES[MultiTableId::UINT32_XOR] = uint_tables::get_uint32_xor_table(MultiTableId::UINT32_XOR);
-    MULTI_TABLES[MultiTableId::UINT32_AND] = uint_tables::get_uint32_and_table(MultiTableId::UINT32_AND);
-    MULTI_TABLES[MultiTableId::BN254_XLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_table(
+    multi_tables[MultiTableId::AES_NORMALIZE] = aes128_tables::get_aes_normalization_table(MultiTableId::AES_NORMALIZE);
+    multi_tables[MultiTableId::AES_INPUT] = aes128_tables::get_aes_input_table(MultiTableId::AES_INPUT);
+    multi_tables[MultiTableId::AES_SBOX] = aes128_tables::get_aes_sbox_table(MultiTableId::AES_SBOX);
+    multi_tables[MultiTableId::UINT32_XOR] = uint_tables::get_uint32_xor_table(MultiTableId::UINT32_XOR);
+    multi_tables[MultiTableId::UINT32_AND] = uint_tables::get_uint32_and_table(MultiTableId::UINT32_AND);
+    multi_tables[MultiTableId::BN254_XLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_table(
         MultiTableId::BN254_XLO, BasicTableId::BN254_XLO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_table(
+    multi_tables[MultiTableId::BN254_XHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_table(
         MultiTableId::BN254_XHI, BasicTableId::BN254_XHI_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_YLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_ylo_table(
+    multi_tables[MultiTableId::BN254_YLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_ylo_table(
         MultiTableId::BN254_YLO, BasicTableId::BN254_YLO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_YHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_yhi_table(
+    multi_tables[MultiTableId::BN254_YHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_yhi_table(
         MultiTableId::BN254_YHI, BasicTableId::BN254_YHI_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XYPRIME] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_table(
+    multi_tables[MultiTableId::BN254_XYPRIME] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_table(
         MultiTableId::BN254_XYPRIME, BasicTableId::BN254_XYPRIME_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XLO_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_endo_table(
+    multi_tables[MultiTableId::BN254_XLO_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_endo_table(
         MultiTableId::BN254_XLO_ENDO, BasicTableId::BN254_XLO_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XHI_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_endo_table(
+    multi_tables[MultiTableId::BN254_XHI_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_endo_table(
         MultiTableId::BN254_XHI_ENDO, BasicTableId::BN254_XHI_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XYPRIME_ENDO] =
+    multi_tables[MultiTableId::BN254_XYPRIME_ENDO] =
         ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_endo_table(
             MultiTableId::BN254_XYPRIME_ENDO, BasicTableId::BN254_XYPRIME_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_table(
+    multi_tables[MultiTableId::SECP256K1_XLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_table(
         MultiTableId::SECP256K1_XLO, BasicTableId::SECP256K1_XLO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_table(
+    multi_tables[MultiTableId::SECP256K1_XHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_table(
         MultiTableId::SECP256K1_XHI, BasicTableId::SECP256K1_XHI_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_YLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_ylo_table(
+    multi_tables[MultiTableId::SECP256K1_YLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_ylo_table(
         MultiTableId::SECP256K1_YLO, BasicTableId::SECP256K1_YLO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_YHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_yhi_table(
+    multi_tables[MultiTableId::SECP256K1_YHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_yhi_table(
         MultiTableId::SECP256K1_YHI, BasicTableId::SECP256K1_YHI_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XYPRIME] =
+    multi_tables[MultiTableId::SECP256K1_XYPRIME] =
         ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xyprime_table(
             MultiTableId::SECP256K1_XYPRIME, BasicTableId::SECP256K1_XYPRIME_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XLO_ENDO] =
+    multi_tables[MultiTableId::SECP256K1_XLO_ENDO] =
         ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_endo_table(
             MultiTableId::SECP256K1_XLO_ENDO, BasicTableId::SECP256K1_XLO_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XHI_ENDO] =
+    multi_tables[MultiTableId::SECP256K1_XHI_ENDO] =
         ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_endo_table(
             MultiTableId::SECP256K1_XHI_ENDO, BasicTableId::SECP256K1_XHI_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XYPRIME_ENDO] =
+    multi_tables[MultiTableId::SECP256K1_XYPRIME_ENDO] =
         ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xyprime_endo_table(
             MultiTableId::SECP256K1_XYPRIME_ENDO, BasicTableId::SECP256K1_XYPRIME_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR] = blake2s_tables::get_blake2s_xor_table(MultiTableId::BLAKE_XOR);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_16] =
+    multi_tables[MultiTableId::BLAKE_XOR] = blake2s_tables::get_blake2s_xor_table(MultiTableId::BLAKE_XOR);
+    multi_tables[MultiTableId::BLAKE_XOR_ROTATE_16] =
         blake2s_tables::get_blake2s_xor_rotate_16_table(MultiTableId::BLAKE_XOR_ROTATE_16);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_8] =
+    multi_tables[MultiTableId::BLAKE_XOR_ROTATE_8] =
         blake2s_tables::get_blake2s_xor_rotate_8_table(MultiTableId::BLAKE_XOR_ROTATE_8);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_7] =
+    multi_tables[MultiTableId::BLAKE_XOR_ROTATE_7] =
         blake2s_tables::get_blake2s_xor_rotate_7_table(MultiTableId::BLAKE_XOR_ROTATE_7);
-    MULTI_TABLES[MultiTableId::KECCAK_FORMAT_INPUT] =
+    multi_tables[MultiTableId::KECCAK_FORMAT_INPUT] =
         keccak_tables::KeccakInput::get_keccak_input_table(MultiTableId::KECCAK_FORMAT_INPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_THETA_OUTPUT] =
+    multi_tables[MultiTableId::KECCAK_THETA_OUTPUT] =
         keccak_tables::Theta::get_theta_output_table(MultiTableId::KECCAK_THETA_OUTPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_CHI_OUTPUT] =
+    multi_tables[MultiTableId::KECCAK_CHI_OUTPUT] =
         keccak_tables::Chi::get_chi_output_table(MultiTableId::KECCAK_CHI_OUTPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_FORMAT_OUTPUT] =
+    multi_tables[MultiTableId::KECCAK_FORMAT_OUTPUT] =
         keccak_tables::KeccakOutput::get_keccak_output_table(MultiTableId::KECCAK_FORMAT_OUTPUT);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_LEFT_LO] =
+    multi_tables[MultiTableId::FIXED_BASE_LEFT_LO] =
         fixed_base::table::get_fixed_base_table<0, 128>(MultiTableId::FIXED_BASE_LEFT_LO);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_LEFT_HI] =
+    multi_tables[MultiTableId::FIXED_BASE_LEFT_HI] =
         fixed_base::table::get_fixed_base_table<1, 126>(MultiTableId::FIXED_BASE_LEFT_HI);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_RIGHT_LO] =
+    multi_tables[MultiTableId::FIXED_BASE_RIGHT_LO] =
         fixed_base::table::get_fixed_base_table<2, 128>(MultiTableId::FIXED_BASE_RIGHT_LO);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_RIGHT_HI] =
+    multi_tables[MultiTableId::FIXED_BASE_RIGHT_HI] =
         fixed_base::table::get_fixed_base_table<3, 126>(MultiTableId::FIXED_BASE_RIGHT_HI);
 
     bb::constexpr_for<0, 25, 1>([&]<size_t i>() {
-        MULTI_TABLES[static_cast<size_t>(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE) + i] =
+        multi_tables[static_cast<size_t>(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE) + i] =
             keccak_tables::Rho<8, i>::get_rho_output_table(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE);
     });
-    MULTI_TABLES[MultiTableId::HONK_DUMMY_MULTI] = dummy_tables::get_honk_dummy_multitable();
-    initialised = true;
+    multi_tables[MultiTableId::HONK_DUMMY_MULTI] = dummy_tables::get_honk_dummy_multitable();
+    return multi_tables;
+}
+
+std::string get_basic_table_cache_path(const std::string& cache_dir, const BasicTableId id)
+{
+    return cache_dir + "/basic_table_v" + std::to_string(BASIC_TABLE_CACHE_VERSION) + "_" +
+           std::to_string(static_cast<size_t>(id)) + ".dat";
 }
 } // namespace
+
 const MultiTable& create_table(const MultiTableId id)
 {
-    if (!initialised) {
-        init_multi_tables();
-        initialised = true;
+    // Initialization of a function-local static is thread-safe, and happens on first use only
+    static const MultiTables multi_tables = init_multi_tables();
+    return multi_tables[id];
+}
+
+/**
+ * @brief Load a basic table from a cache directory, if it holds a valid file for this version of the tables
+ *
+ * @note The key-to-value function is not stored, so get_values_from_key is null on loaded tables. Reads are always
+ * evaluated through the MultiTable query functions, so the builders never need it.
+ */
+std::optional<BasicTable> read_cached_basic_table(const std::string& cache_dir, const BasicTableId id)
+{
+    using serialize::read;
+    std::ifstream file(get_basic_table_cache_path(cache_dir, id), std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+    const std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (buffer.size() < 2 * sizeof(uint32_t)) {
+        return std::nullopt;
+    }
+
+    const uint8_t* it = buffer.data();
+    uint32_t version = 0;
+    uint32_t table_id = 0;
+    read(it, version);
+    read(it, table_id);
+    if (version != BASIC_TABLE_CACHE_VERSION || table_id != static_cast<uint32_t>(id)) {
+        return std::nullopt;
+    }
+
+    BasicTable table;
+    uint64_t size = 0;
+    table.id = id;
+    table.table_index = 0;
+    table.get_values_from_key = nullptr;
+    read(it, size);
+    read(it, table.use_twin_keys);
+    read(it, table.column_1_step_size);
+    read(it, table.column_2_step_size);
+    read(it, table.column_3_step_size);
+    table.size = static_cast<size_t>(size);
+    const size_t expected_size = static_cast<size_t>(it - buffer.data()) + 3 * (sizeof(uint32_t) + size * sizeof(fr));
+    if (buffer.size() != expected_size) {
+        return std::nullopt;
+    }
+    // Each column carries its own length prefix; a file whose prefixes disagree with the table size is corrupt even if
+    // the total length matches
+    for (auto* column : { &table.column_1, &table.column_2, &table.column_3 }) {
+        uint32_t column_size = 0;
+        const uint8_t* column_it = it;
+        read(column_it, column_size);
+        if (column_size != size) {
+            return std::nullopt;
+        }
+        read(it, *column);
+    }
+    return table;
+}
+
+/**
+ * @brief Store a basic table in a cache directory, from which read_cached_basic_table can load it
+ */
+void write_cached_basic_table(const std::string& cache_dir, const BasicTable& table)
+{
+    using serialize::write;
+    std::vector<uint8_t> buffer;
+    write(buffer, BASIC_TABLE_CACHE_VERSION);
+    write(buffer, static_cast<uint32_t>(table.id));
+    write(buffer, static_cast<uint64_t>(table.size));
+    write(buffer, table.use_twin_keys);
+    write(buffer, table.column_1_step_size);
+    write(buffer, table.column_2_step_size);
+    write(buffer, table.column_3_step_size);
+    write(buffer, table.column_1);
+    write(buffer, table.column_2);
+    write(buffer, table.column_3);
+
+    // Write to a temporary file first so that readers never observe a partially written table. Every writer, in this
+    // or any other process, gets its own temporary file; the renames are atomic and all produce identical files.
+#ifndef __wasm__
+    const std::string path = get_basic_table_cache_path(cache_dir, table.id);
+    std::string tmp_path = path + ".XXXXXX";
+    const int fd = mkstemp(tmp_path.data());
+    if (fd < 0) {
+        return;
+    }
+    // mkstemp creates the file readable by its owner only; the cache may be shared with other users
+    fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    size_t written = 0;
+    while (written < buffer.size()) {
+        const auto result = ::write(fd, buffer.data() + written, buffer.size() - written);
+        if (result <= 0) {
+            break;
+        }
+        written += static_cast<size_t>(result);
     }
-    return MULTI_TABLES[id];
+    const bool closed = close(fd) == 0;
+    if (written != buffer.size() || !closed || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+    }
+#endif
+}
+
+void set_basic_table_cache_dir(const std::string& cache_dir)
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(basic_table_cache_dir_mutex);
+#endif
+    basic_table_cache_dir = cache_dir;
+}
+
+const BasicTable& get_precomputed_basic_table(const BasicTableId id)
+{
+    // Each table has its own once_flag, so threads only wait on the generation of the table they need
+    std::call_once(basic_table_once_flags[id], [id]() {
+        auto& table = BASIC_TABLES[id];
+        const std::string cache_dir = get_basic_table_cache_dir();
+        if (!cache_dir.empty()) {
+            if (auto cached = read_cached_basic_table(cache_dir, id)) {
+                table = std::make_unique<const BasicTable>(std::move(*cached));
+                return;
+            }
+        }
+        table = std::make_unique<const BasicTable>(create_basic_table(id, 0));
+        if (!cache_dir.empty()) {
+            write_cached_basic_table(cache_dir, *table);
+        }
+    });
+    return *BASIC_TABLES[id];
 }
 
 ReadData<bb::fr> get_lookup_accumulators(const MultiTableId id,
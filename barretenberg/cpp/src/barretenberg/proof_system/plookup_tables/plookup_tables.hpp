@@ -1,5 +1,7 @@
 #pragma once
 #include "barretenberg/common/throw_or_abort.hpp"
+#include <optional>
+#include <string>
 
 #include "./fixed_base/fixed_base.hpp"
 #include "aes128.hpp"
@@ -20,6 +22,25 @@ namespace bb::plookup {
 
 const MultiTable& create_table(MultiTableId id);
 
+/**
+ * @brief Get the process-wide instance of a basic table, computing it on first use
+ *
+ * @details The returned table is shared by all builders and threads and must not be modified; builders copy it into
+ * their own list of tables (setting its table_index) when it is first used by their circuit.
+ */
+const BasicTable& get_precomputed_basic_table(BasicTableId id);
+
+/**
+ * @brief Persist basic tables in the given directory, so that subsequent processes load them instead of regenerating
+ * @details Defaults to the BB_LOOKUP_TABLE_CACHE_DIR environment variable (the bb CLI also takes
+ * --lookup_table_cache_dir). An empty directory disables the disk cache. Only tables generated after the call are
+ * affected.
+ */
+void set_basic_table_cache_dir(const std::string& cache_dir);
+
+std::optional<BasicTable> read_cached_basic_table(const std::string& cache_dir, BasicTableId id);
+void write_cached_basic_table(const std::string& cache_dir, const BasicTable& table);
+
 ReadData<bb::fr> get_lookup_accumulators(MultiTableId id,
                                          const bb::fr& key_a,
                                          const bb::fr& key_b = 0,
@@ -0,0 +1,88 @@
+#include "plookup_tables.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::plookup;
+
+namespace {
+void expect_same_contents(const BasicTable& actual, const BasicTable& expected)
+{
+    EXPECT_EQ(actual.id, expected.id);
+    EXPECT_EQ(actual.size, expected.size);
+    EXPECT_EQ(actual.use_twin_keys, expected.use_twin_keys);
+    EXPECT_EQ(actual.column_1_step_size, expected.column_1_step_size);
+    EXPECT_EQ(actual.column_2_step_size, expected.column_2_step_size);
+    EXPECT_EQ(actual.column_3_step_size, expected.column_3_step_size);
+    EXPECT_EQ(actual.column_1, expected.column_1);
+    EXPECT_EQ(actual.column_2, expected.column_2);
+    EXPECT_EQ(actual.column_3, expected.column_3);
+}
+} // namespace
+
+/**
+ * @brief Builders get copies of the shared precomputed tables, indexed in the order they were first used
+ */
+TEST(PlookupTables, PrecomputedBasicTables)
+{
+    const auto& uint_xor = get_precomputed_basic_table(UINT_XOR_ROTATE0);
+    EXPECT_EQ(&uint_xor, &get_precomputed_basic_table(UINT_XOR_ROTATE0));
+    expect_same_contents(uint_xor, create_basic_table(UINT_XOR_ROTATE0, 0));
+
+    UltraCircuitBuilder builder;
+    builder.get_table(FIXED_BASE_0_0);
+    builder.get_table(UINT_AND_ROTATE0);
+    builder.get_table(FIXED_BASE_0_0);
+    ASSERT_EQ(builder.lookup_tables.size(), 2);
+    EXPECT_EQ(builder.lookup_tables[0].table_index, 0);
+    EXPECT_EQ(builder.lookup_tables[1].table_index, 1);
+    expect_same_contents(builder.lookup_tables[0], create_basic_table(FIXED_BASE_0_0, 0));
+    expect_same_contents(builder.lookup_tables[1], create_basic_table(UINT_AND_ROTATE0, 0));
+}
+
+/**
+ * @brief Basic tables written to the on-disk cache are read back unchanged, and stale or corrupt files are ignored
+ */
+TEST(PlookupTables, BasicTableCache)
+{
+    const auto cache_dir = std::filesystem::temp_directory_path() / "bb_plookup_tables_test";
+    std::filesystem::remove_all(cache_dir);
+    std::filesystem::create_directories(cache_dir);
+
+    EXPECT_FALSE(read_cached_basic_table(cache_dir, FIXED_BASE_1_0).has_value());
+
+    const BasicTable table = create_basic_table(FIXED_BASE_1_0, 0);
+    write_cached_basic_table(cache_dir, table);
+    const auto cached = read_cached_basic_table(cache_dir, FIXED_BASE_1_0);
+    ASSERT_TRUE(cached.has_value());
+    expect_same_contents(*cached, table);
+
+    // Truncated files are rejected
+    const auto path = cache_dir / ("basic_table_v1_" + std::to_string(FIXED_BASE_1_0) + ".dat");
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_FALSE(read_cached_basic_table(cache_dir, FIXED_BASE_1_0).has_value());
+
+    // Column length prefixes that disagree with the table size are rejected, even if the file length matches
+    write_cached_basic_table(cache_dir, table);
+    {
+        const auto column_bytes = sizeof(uint32_t) + table.size * sizeof(fr);
+        const auto column_1_offset = std::filesystem::file_size(path) - 3 * column_bytes;
+        std::vector<uint8_t> prefix;
+        serialize::write(prefix, static_cast<uint32_t>(table.size - 1));
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(column_1_offset));
+        file.write(reinterpret_cast<const char*>(prefix.data()), static_cast<std::streamsize>(prefix.size()));
+    }
+    EXPECT_FALSE(read_cached_basic_table(cache_dir, FIXED_BASE_1_0).has_value());
+
+    // A file stored under one id is never served for another
+    write_cached_basic_table(cache_dir, table);
+    const auto other_id = static_cast<BasicTableId>(FIXED_BASE_1_0 + 1);
+    std::filesystem::rename(path, cache_dir / ("basic_table_v1_" + std::to_string(other_id) + ".dat"));
+    EXPECT_FALSE(read_cached_basic_table(cache_dir, other_id).has_value());
+
+    std::filesystem::remove_all(cache_dir);
+}
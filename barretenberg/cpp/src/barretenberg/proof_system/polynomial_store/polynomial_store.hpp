@@ -28,6 +28,12 @@ template <typename Fr> class PolynomialStore {
 
     void remove(std::string const& key);
 
+    /**
+     * Everything is held in memory, so there is nothing to prefetch. Provided so provers can hint upcoming reads
+     * regardless of which store backs the proving key.
+     */
+    void prefetch(std::string const& /*unused*/){};
+
     size_t get_size_in_bytes() const;
 
     void print();
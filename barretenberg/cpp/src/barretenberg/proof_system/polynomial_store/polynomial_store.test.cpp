@@ -3,6 +3,7 @@
 
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "polynomial_store.hpp"
+#include "polynomial_store_cache.hpp"
 
 using namespace bb;
 
@@ -85,3 +86,99 @@ TEST(PolynomialStore, Remove)
     EXPECT_THROW(polynomial_store.get("id_1"), std::out_of_range);
     EXPECT_EQ(polynomial_store.get_size_in_bytes(), bytes_expected);
 }
+
+// Ensure that polynomials evicted from a cache bounded in count and bytes are read back intact from the external store
+TEST(PolynomialStoreCache, EvictsToExternalStore)
+{
+    const size_t size = 100;
+    // Room for two polynomials by bytes, three by count.
+    PolynomialStoreCache polynomial_store(3, 2 * size * sizeof(fr));
+
+    std::vector<Polynomial<fr>> copies;
+    for (size_t i = 0; i < 6; ++i) {
+        Polynomial<fr> poly(size + i);
+        for (auto& coeff : poly) {
+            coeff = fr::random_element();
+        }
+        copies.emplace_back(poly);
+        polynomial_store.put("id_" + std::to_string(i), std::move(poly));
+    }
+
+    for (size_t i = 0; i < 6; ++i) {
+        polynomial_store.prefetch("id_" + std::to_string(i));
+        EXPECT_EQ(copies[i], polynomial_store.get("id_" + std::to_string(i)));
+    }
+
+    // A polynomial larger than the byte ceiling bypasses the cache entirely.
+    Polynomial<fr> large_poly(4 * size);
+    large_poly[3] = fr::random_element();
+    Polynomial<fr> large_poly_copy(large_poly);
+    polynomial_store.put("large", std::move(large_poly));
+    EXPECT_EQ(large_poly_copy, polynomial_store.get("large"));
+}
+
+// Ensure that a copy of a cache owns its entries: it can evict to its external store after the source is gone
+TEST(PolynomialStoreCache, CopyThenEvict)
+{
+    const size_t size = 100;
+    const size_t num_polys = 4;
+
+    std::vector<Polynomial<fr>> copies;
+    auto source = std::make_unique<PolynomialStoreCache>(3, 2 * size * sizeof(fr));
+    for (size_t i = 0; i < num_polys; ++i) {
+        Polynomial<fr> poly(size);
+        for (auto& coeff : poly) {
+            coeff = fr::random_element();
+        }
+        copies.emplace_back(poly);
+        source->put("id_" + std::to_string(i), std::move(poly));
+    }
+
+    PolynomialStoreCache copy(*source);
+    source.reset();
+
+    // Force the copy to evict everything it inherited from the source.
+    for (size_t i = num_polys; i < 2 * num_polys; ++i) {
+        Polynomial<fr> poly(size);
+        for (auto& coeff : poly) {
+            coeff = fr::random_element();
+        }
+        copies.emplace_back(poly);
+        copy.put("id_" + std::to_string(i), std::move(poly));
+    }
+
+    for (size_t i = 0; i < 2 * num_polys; ++i) {
+        EXPECT_EQ(copies[i], copy.get("id_" + std::to_string(i)));
+    }
+
+    PolynomialStoreCache moved(std::move(copy));
+    moved.put("id_moved", Polynomial<fr>(size));
+    for (size_t i = 0; i < 2 * num_polys; ++i) {
+        EXPECT_EQ(copies[i], moved.get("id_" + std::to_string(i)));
+    }
+}
+
+#ifndef __wasm__
+// Ensure that rewriting a key in place in a file store does not change what a copy of the store reads back
+TEST(PolynomialStoreFile, CopyDoesNotShareSlots)
+{
+    const size_t size = 100;
+    PolynomialStoreFile<fr> store;
+
+    Polynomial<fr> poly(size);
+    poly[0] = fr::random_element();
+    Polynomial<fr> poly_copy(poly);
+    store.put("id", std::move(poly));
+
+    PolynomialStoreFile<fr> copy(store);
+
+    // Same size, so the original store reuses the slot of "id".
+    Polynomial<fr> rewritten(size);
+    rewritten[0] = fr::random_element();
+    Polynomial<fr> rewritten_copy(rewritten);
+    store.put("id", std::move(rewritten));
+
+    EXPECT_EQ(rewritten_copy, store.get("id"));
+    EXPECT_EQ(poly_copy, copy.get("id"));
+}
+#endif
@@ -1,29 +1,103 @@
 #include "./polynomial_store_cache.hpp"
+#include <cstdlib>
+#include <utility>
 
 namespace bb {
 
+namespace {
+size_t default_max_cache_bytes()
+{
+#ifdef __wasm__
+    return 0;
+#else
+    static auto val = std::getenv("BB_POLYNOMIAL_STORE_MAX_MB");
+    return val ? std::stoul(val) << 20 : 0;
+#endif
+}
+} // namespace
+
 PolynomialStoreCache::PolynomialStoreCache()
     : max_cache_size_(40)
+    , max_cache_bytes_(default_max_cache_bytes())
 {}
 
 PolynomialStoreCache::PolynomialStoreCache(size_t max_cache_size)
     : max_cache_size_(max_cache_size)
 {}
 
+PolynomialStoreCache::PolynomialStoreCache(size_t max_cache_size, size_t max_cache_bytes)
+    : max_cache_size_(max_cache_size)
+    , max_cache_bytes_(max_cache_bytes)
+{}
+
+PolynomialStoreCache::PolynomialStoreCache(PolynomialStoreCache const& other)
+    : cache_(other.cache_)
+    , external_store(other.external_store)
+    , max_cache_size_(other.max_cache_size_)
+    , max_cache_bytes_(other.max_cache_bytes_)
+    , cache_bytes_(other.cache_bytes_)
+{
+    rebuild_size_map();
+}
+
+PolynomialStoreCache::PolynomialStoreCache(PolynomialStoreCache&& other) noexcept
+    : cache_(std::move(other.cache_))
+    , external_store(std::move(other.external_store))
+    , max_cache_size_(other.max_cache_size_)
+    , max_cache_bytes_(other.max_cache_bytes_)
+    , cache_bytes_(std::exchange(other.cache_bytes_, 0))
+{
+    other.cache_.clear();
+    other.size_map_.clear();
+    rebuild_size_map();
+}
+
+PolynomialStoreCache& PolynomialStoreCache::operator=(PolynomialStoreCache const& other)
+{
+    if (this != &other) {
+        *this = PolynomialStoreCache(other);
+    }
+    return *this;
+}
+
+PolynomialStoreCache& PolynomialStoreCache::operator=(PolynomialStoreCache&& other) noexcept
+{
+    if (this != &other) {
+        cache_ = std::move(other.cache_);
+        external_store = std::move(other.external_store);
+        max_cache_size_ = other.max_cache_size_;
+        max_cache_bytes_ = other.max_cache_bytes_;
+        cache_bytes_ = std::exchange(other.cache_bytes_, 0);
+        other.cache_.clear();
+        other.size_map_.clear();
+        rebuild_size_map();
+    }
+    return *this;
+}
+
 void PolynomialStoreCache::put(std::string const& key, Polynomial&& value)
 {
     // info("cache put ", key);
+    auto bytes = value.size() * sizeof(bb::fr);
     auto it = cache_.find(key);
     if (it != cache_.end()) {
+        cache_bytes_ = cache_bytes_ - it->second.size() * sizeof(bb::fr) + bytes;
         it->second = std::move(value);
         return;
     }
 
-    purge_until_free();
+    // A polynomial that could never fit goes straight to the external store.
+    if (max_cache_bytes_ != 0 && bytes > max_cache_bytes_) {
+        external_store.put(key, std::move(value));
+        return;
+    }
+
+    purge_until_free(bytes);
 
     auto size = value.size();
     auto [cache_it, _] = cache_.insert({ key, std::move(value) });
     size_map_.insert({ size, cache_it });
+    cache_bytes_ += bytes;
 };
 
 PolynomialStoreCache::Polynomial PolynomialStoreCache::get(std::string const& key)
@@ -38,18 +112,35 @@ PolynomialStoreCache::Polynomial PolynomialStoreCache::get(std::string const& ke
     return external_store.get(key);
 };
 
-void PolynomialStoreCache::purge_until_free()
+void PolynomialStoreCache::prefetch(std::string const& key)
+{
+    if (!cache_.contains(key)) {
+        external_store.prefetch(key);
+    }
+}
+
+void PolynomialStoreCache::rebuild_size_map()
+{
+    size_map_.clear();
+    for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+        size_map_.insert({ it->second.size(), it });
+    }
+}
+
+void PolynomialStoreCache::purge_until_free(size_t incoming_bytes)
 {
-    while (cache_.size() >= max_cache_size_) {
+    while (!cache_.empty() && (cache_.size() >= max_cache_size_ ||
+                               (max_cache_bytes_ != 0 && cache_bytes_ + incoming_bytes > max_cache_bytes_))) {
         auto size_it = size_map_.begin();
         auto [size, cache_it] = *size_it;
         auto key = cache_it->first;
         auto p = std::move(cache_it->second);
         size_map_.erase(size_it);
         cache_.erase(cache_it);
+        cache_bytes_ -= p.size() * sizeof(bb::fr);
         // info("cache purging ", key, " size ", size);
         external_store.put(key, std::move(p));
     }
 }
 
-} // namespace bb
\ No newline at end of file
+} // namespace bb
@@ -1,5 +1,9 @@
 #pragma once
+#ifdef __wasm__
 #include "./polynomial_store_wasm.hpp"
+#else
+#include "./polynomial_store_file.hpp"
+#endif
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <map>
 #include <string>
@@ -14,25 +18,48 @@ namespace bb {
  * In combination with the slab allocator, this brings us to about 4GB mem usage for 512k circuits.
  * In tests using just the external store increased proof time from by about 50%.
  * This pretty much recoups all losses.
+ * The cache can additionally be bounded by a total number of bytes (0 means unbounded). On native builds the external
+ * store is a scratch file, and the default ctor reads the ceiling in MiB from BB_POLYNOMIAL_STORE_MAX_MB.
+ * size_map_ holds iterators into cache_, so copies and moves rebuild it for the destination's own map; a copy holds
+ * copies of the cached polynomials and a copy of the external store.
  */
 class PolynomialStoreCache {
   private:
     using Polynomial = bb::Polynomial<bb::fr>;
     std::map<std::string, Polynomial> cache_;
     std::multimap<size_t, std::map<std::string, Polynomial>::iterator> size_map_;
+#ifdef __wasm__
     PolynomialStoreWasm<bb::fr> external_store;
+#else
+    PolynomialStoreFile<bb::fr> external_store;
+#endif
     size_t max_cache_size_;
+    size_t max_cache_bytes_ = 0;
+    size_t cache_bytes_ = 0;
 
   public:
     PolynomialStoreCache();
     explicit PolynomialStoreCache(size_t max_cache_size_);
+    PolynomialStoreCache(size_t max_cache_size_, size_t max_cache_bytes_);
+    PolynomialStoreCache(PolynomialStoreCache const& other);
+    PolynomialStoreCache(PolynomialStoreCache&& other) noexcept;
+    PolynomialStoreCache& operator=(PolynomialStoreCache const& other);
+    PolynomialStoreCache& operator=(PolynomialStoreCache&& other) noexcept;
+    ~PolynomialStoreCache() = default;
 
     void put(std::string const& key, Polynomial&& value);
 
     Polynomial get(std::string const& key);
 
+    /**
+     * Hint that key will be read soon. Starts loading it from the external store in the background if it has been
+     * evicted from the cache.
+     */
+    void prefetch(std::string const& key);
+
   private:
-    void purge_until_free();
+    void purge_until_free(size_t incoming_bytes);
+    void rebuild_size_map();
 };
 
 } // namespace bb
\ No newline at end of file
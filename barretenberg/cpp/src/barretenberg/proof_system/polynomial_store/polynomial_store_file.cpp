@@ -0,0 +1,129 @@
+#ifndef __wasm__
+#include "polynomial_store_file.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstdlib>
+#include <utility>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace bb {
+
+namespace {
+constexpr size_t SCRATCH_PAGE_SIZE = 4096;
+
+std::string default_scratch_directory()
+{
+    static auto val = std::getenv("BB_SCRATCH_DIR");
+    return val ? val : "/tmp";
+}
+} // namespace
+
+template <typename Fr> PolynomialStoreFile<Fr>::ScratchFile::ScratchFile(std::string const& scratch_directory)
+{
+    std::string path = scratch_directory + "/bb-polynomials-XXXXXX";
+    fd = mkstemp(path.data());
+    if (fd < 0) {
+        throw_or_abort("PolynomialStoreFile: could not create scratch file in " + scratch_directory);
+    }
+    // The file lives only as long as the descriptor.
+    unlink(path.c_str());
+}
+
+template <typename Fr> PolynomialStoreFile<Fr>::ScratchFile::~ScratchFile()
+{
+    close(fd);
+}
+
+template <typename Fr>
+PolynomialStoreFile<Fr>::PolynomialStoreFile()
+    : PolynomialStoreFile(default_scratch_directory())
+{}
+
+template <typename Fr>
+PolynomialStoreFile<Fr>::PolynomialStoreFile(std::string scratch_directory)
+    : directory(std::move(scratch_directory))
+{}
+
+template <typename Fr>
+PolynomialStoreFile<Fr>::PolynomialStoreFile(PolynomialStoreFile const& other)
+    : directory(other.directory)
+{
+    for (auto const& [key, slot] : other.slots) {
+        put(key, other.get(key));
+    }
+}
+
+template <typename Fr> PolynomialStoreFile<Fr>& PolynomialStoreFile<Fr>::operator=(PolynomialStoreFile const& other)
+{
+    if (this != &other) {
+        *this = PolynomialStoreFile(other);
+    }
+    return *this;
+}
+
+template <typename Fr> void PolynomialStoreFile<Fr>::put(std::string const& key, Polynomial&& value)
+{
+    if (!file) {
+        file = std::make_unique<ScratchFile>(directory);
+    }
+    const size_t num_bytes = value.size() * sizeof(Fr);
+    auto it = slots.find(key);
+    if (it == slots.end() || it->second.capacity_in_bytes < num_bytes) {
+        const size_t capacity = (num_bytes + SCRATCH_PAGE_SIZE - 1) & ~(SCRATCH_PAGE_SIZE - 1);
+        slots[key] = { file->end, value.size(), capacity };
+        file->end += capacity;
+    } else {
+        it->second.size = value.size();
+    }
+
+    const Slot& slot = slots[key];
+    const auto* buf = reinterpret_cast<const uint8_t*>(value.data().get());
+    size_t written = 0;
+    while (written < num_bytes) {
+        auto result = pwrite(file->fd, buf + written, num_bytes - written, (off_t)(slot.offset + written));
+        if (result <= 0) {
+            throw_or_abort("PolynomialStoreFile: failed to write " + key);
+        }
+        written += (size_t)result;
+    }
+#ifdef POSIX_FADV_DONTNEED
+    // The pages were just written, there is no point keeping them in the page cache until the next prefetch.
+    posix_fadvise(file->fd, (off_t)slot.offset, (off_t)num_bytes, POSIX_FADV_DONTNEED);
+#endif
+};
+
+template <typename Fr> bb::Polynomial<Fr> PolynomialStoreFile<Fr>::get(std::string const& key) const
+{
+    const Slot& slot = slots.at(key);
+    auto p = Polynomial(slot.size, DontZeroMemory::FLAG);
+    const size_t num_bytes = slot.size * sizeof(Fr);
+    auto* buf = reinterpret_cast<uint8_t*>(p.data().get());
+    size_t bytes_read = 0;
+    while (bytes_read < num_bytes) {
+        auto result = pread(file->fd, buf + bytes_read, num_bytes - bytes_read, (off_t)(slot.offset + bytes_read));
+        if (result <= 0) {
+            throw_or_abort("PolynomialStoreFile: failed to read " + key);
+        }
+        bytes_read += (size_t)result;
+    }
+    return p;
+};
+
+template <typename Fr> void PolynomialStoreFile<Fr>::prefetch(std::string const& key) const
+{
+#ifdef POSIX_FADV_WILLNEED
+    auto it = slots.find(key);
+    if (it == slots.end()) {
+        return;
+    }
+    posix_fadvise(file->fd, (off_t)it->second.offset, (off_t)(it->second.size * sizeof(Fr)), POSIX_FADV_WILLNEED);
+#else
+    static_cast<void>(key);
+#endif
+}
+
+template class PolynomialStoreFile<bb::fr>;
+
+} // namespace bb
+#endif
@@ -0,0 +1,57 @@
+#pragma once
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace bb {
+
+/**
+ * A native external store for the PolynomialStoreCache. Evicted polynomials are written to an unlinked scratch file
+ * (in BB_SCRATCH_DIR, or /tmp) at page aligned offsets, and read back on a cache miss. Rewriting a key reuses its
+ * slot when the new polynomial fits.
+ * Since the prover's access schedule is known ahead of time, callers can prefetch() a key before they need it; this
+ * asks the kernel to start reading the pages in the background so the subsequent get() is served from the page cache.
+ * The file is created on the first put(). A copy gets its own scratch file holding copies of the stored polynomials,
+ * so that a put() which rewrites a slot in place can never change what another store reads back.
+ */
+template <typename Fr> class PolynomialStoreFile {
+  private:
+    using Polynomial = bb::Polynomial<Fr>;
+
+    struct Slot {
+        size_t offset;
+        size_t size;
+        size_t capacity_in_bytes;
+    };
+
+    struct ScratchFile {
+        int fd = -1;
+        size_t end = 0;
+        explicit ScratchFile(std::string const& scratch_directory);
+        ScratchFile(ScratchFile const&) = delete;
+        ScratchFile& operator=(ScratchFile const&) = delete;
+        ~ScratchFile();
+    };
+
+    std::string directory;
+    std::unique_ptr<ScratchFile> file;
+    std::unordered_map<std::string, Slot> slots;
+
+  public:
+    PolynomialStoreFile();
+    explicit PolynomialStoreFile(std::string scratch_directory);
+    PolynomialStoreFile(PolynomialStoreFile const& other);
+    PolynomialStoreFile(PolynomialStoreFile&& other) noexcept = default;
+    PolynomialStoreFile& operator=(PolynomialStoreFile const& other);
+    PolynomialStoreFile& operator=(PolynomialStoreFile&& other) noexcept = default;
+    ~PolynomialStoreFile() = default;
+
+    void put(std::string const& key, Polynomial&& value);
+
+    Polynomial get(std::string const& key) const;
+
+    void prefetch(std::string const& key) const;
+};
+
+} // namespace bb
@@ -14,6 +14,8 @@ template <typename Fr> class PolynomialStoreWasm {
     void put(std::string const& key, Polynomial&& value);
 
     Polynomial get(std::string const& key);
+
+    void prefetch(std::string const& /*unused*/){};
 };
 
 } // namespace bb
@@ -8,6 +8,7 @@
 #include "barretenberg/polynomials/pow.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/protogalaxy/folding_result.hpp"
+#include "barretenberg/protogalaxy/prover_verifier_shared.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/sumcheck/instance/instances.hpp"
@@ -130,6 +131,68 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     // FoldingParameters set and be the result of a previous round of folding.
     std::shared_ptr<Instance> get_accumulator() { return instances[0]; }
 
+    /**
+     * @brief Determine the number of threads over which the rows of an execution trace of the given size are divided.
+     * @details We use a power of 2 number of threads, each handling at least a minimum number of rows, so that the
+     * trace is evenly divided.
+     */
+    static size_t compute_num_threads(const size_t instance_size)
+    {
+        const size_t max_num_threads = get_num_cpus_pow2(); // number of available threads (power of 2)
+        const size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a thread
+        const size_t desired_num_threads = instance_size / min_iterations_per_thread;
+        const size_t num_threads = std::min(desired_num_threads, max_num_threads); // fewer than max if justified
+        return num_threads > 0 ? num_threads : 1;                                   // ensure num threads is >= 1
+    }
+
+    /**
+     * @brief Whether all prover polynomials of all the given instances vanish at the given row.
+     * @details Every relation vanishes on an all-zero input, so such a row contributes nothing to either the full Honk
+     * evaluations or the combiner and can be skipped altogether.
+     *
+     * @param polynomials_views For each instance, a view of all its prover polynomials
+     */
+    template <typename PolynomialsViews>
+    static bool row_is_zero(const PolynomialsViews& polynomials_views, const size_t row_idx)
+    {
+        for (const auto& instance_polynomials : polynomials_views) {
+            for (const auto& polynomial : instance_polynomials) {
+                if (!polynomial[row_idx].is_zero()) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Add the contribution of each relation at a single row to the relation evaluations, skipping the relations
+     * that report (via their selectors) that their contribution at this row vanishes.
+     * @details Gates of a given type typically occupy a small portion of the execution trace and rows past the end of
+     * the circuit are not gates at all, so most relations are skipped on most rows.
+     */
+    template <size_t relation_idx = 0>
+    static void accumulate_relation_evaluations(const RowEvaluations& row,
+                                                RelationEvaluations& relation_evaluations,
+                                                const RelationParameters<FF>& relation_parameters)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        bool skip_relation = false;
+        if constexpr (isSkippable<Relation, RowEvaluations>) {
+            skip_relation = Relation::skip(row);
+        }
+        // Note that the evaluations are accumulated with the gate separation challenge being 1 at this stage, as this
+        // specific randomness is added later through the power polynomial univariate specific to ProtoGalaxy
+        if (!skip_relation) {
+            Relation::accumulate(std::get<relation_idx>(relation_evaluations), row, relation_parameters, FF(1));
+        }
+
+        // Repeat for the next relation.
+        if constexpr (relation_idx + 1 < Flavor::NUM_RELATIONS) {
+            accumulate_relation_evaluations<relation_idx + 1>(row, relation_evaluations, relation_parameters);
+        }
+    }
+
     /**
      * @brief Compute the values of the full Honk relation at each row in the execution trace, representing f_i(ω) in
      * the ProtoGalaxy paper, given the evaluations of all the prover polynomials and \vec{α} (the batching challenges
@@ -141,34 +204,48 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * row. At the end of the function, the linearly dependent contribution is accumulated at index 0 representing the
      * sum f_0(ω) + α_j*g(ω) where f_0 represents the full honk evaluation at row 0, g(ω) is the linearly dependent
      * subrelation and α_j is its corresponding batching challenge.
+     *
+     * Each thread handles a contiguous range of rows, reading every row into a single container it owns, and skips
+     * rows on which all polynomials vanish as well as relations whose selectors vanish on a row.
      */
     static std::vector<FF> compute_full_honk_evaluations(const ProverPolynomials& instance_polynomials,
                                                          const RelationSeparator& alpha,
                                                          const RelationParameters<FF>& relation_parameters)
     {
-        auto instance_size = instance_polynomials.get_polynomial_size();
+        BB_OP_COUNT_TIME();
+        const size_t instance_size = instance_polynomials.get_polynomial_size();
+        const size_t num_threads = compute_num_threads(instance_size);
+        const size_t iterations_per_thread = instance_size / num_threads;
+
         std::vector<FF> full_honk_evaluations(instance_size);
-        std::vector<FF> linearly_dependent_contributions(instance_size);
-        parallel_for(instance_size, [&](size_t row) {
-            auto row_evaluations = instance_polynomials.get_row(row);
+        std::vector<FF> linearly_dependent_contributions(num_threads, FF(0));
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * iterations_per_thread;
+            const size_t end = (thread_idx + 1) * iterations_per_thread;
+            const std::array<decltype(instance_polynomials.get_all()), 1> polynomials_views{
+                instance_polynomials.get_all()
+            };
+            RowEvaluations row;
             RelationEvaluations relation_evaluations;
-            Utils::zero_elements(relation_evaluations);
-
-            // Note that the evaluations are accumulated with the gate separation challenge
-            // being 1 at this stage, as this specific randomness is added later through the
-            // power polynomial univariate specific to ProtoGalaxy
-            Utils::template accumulate_relation_evaluations<>(
-                row_evaluations, relation_evaluations, relation_parameters, FF(1));
-
-            auto output = FF(0);
-            auto running_challenge = FF(1);
-
-            // Sum relation evaluations, batched by their corresponding relation separator challenge, to
-            // get the value of the full honk relation at a specific row
-            linearly_dependent_contributions[row] = 0;
-            Utils::scale_and_batch_elements(
-                relation_evaluations, alpha, running_challenge, output, linearly_dependent_contributions[row]);
-            full_honk_evaluations[row] = output;
+
+            for (size_t idx = start; idx < end; idx++) {
+                if (row_is_zero(polynomials_views, idx)) {
+                    full_honk_evaluations[idx] = FF(0);
+                    continue;
+                }
+                for (auto [value, polynomial] : zip_view(row.get_all(), polynomials_views[0])) {
+                    value = polynomial[idx];
+                }
+                Utils::zero_elements(relation_evaluations);
+                accumulate_relation_evaluations(row, relation_evaluations, relation_parameters);
+
+                // Sum relation evaluations, batched by their corresponding relation separator challenge, to
+                // get the value of the full honk relation at a specific row
+                auto output = FF(0);
+                Utils::scale_and_batch_elements(
+                    relation_evaluations, alpha, FF(1), output, linearly_dependent_contributions[thread_idx]);
+                full_honk_evaluations[idx] = output;
+            }
         });
 
         for (FF& linearly_dependent_contribution : linearly_dependent_contributions) {
@@ -177,37 +254,6 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         return full_honk_evaluations;
     }
 
-    /**
-     * @brief  Recursively compute the parent nodes of each level in the tree, starting from the leaves. Note that at
-     * each level, the resulting parent nodes will be polynomials of degree (level+1) because we multiply by an
-     * additional factor of X.
-     */
-    static std::vector<FF> construct_coefficients_tree(const std::vector<FF>& betas,
-                                                       const std::vector<FF>& deltas,
-                                                       const std::vector<std::vector<FF>>& prev_level_coeffs,
-                                                       size_t level = 1)
-    {
-        // if we are at level t in the tree, where t = logn and n is the instance size, we have reached the root which
-        // contains the coefficients of the perturbator polynomial
-        if (level == betas.size()) {
-            return prev_level_coeffs[0];
-        }
-
-        auto degree = level + 1;
-        auto prev_level_width = prev_level_coeffs.size();
-        // we need degree + 1 terms to represent the intermediate polynomials
-        std::vector<std::vector<FF>> level_coeffs(prev_level_width >> 1, std::vector<FF>(degree + 1, 0));
-        for (size_t node = 0; node < prev_level_width; node += 2) {
-            auto parent = node >> 1;
-            std::copy(prev_level_coeffs[node].begin(), prev_level_coeffs[node].end(), level_coeffs[parent].begin());
-            for (size_t d = 0; d < degree; d++) {
-                level_coeffs[parent][d] += prev_level_coeffs[node + 1][d] * betas[level];
-                level_coeffs[parent][d + 1] += prev_level_coeffs[node + 1][d] * deltas[level];
-            }
-        }
-        return construct_coefficients_tree(betas, deltas, level_coeffs, level + 1);
-    }
-
     /**
      * @brief We construct the coefficients of the perturbator polynomial in O(n) time following the technique in
      * Claim 4.4. Consider a binary tree whose leaves are the evaluations of the full Honk relation at each row in the
@@ -215,21 +261,74 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * the tree, label the branch connecting the left node n_l to its parent by 1 and for the right node n_r by β_i +
      * δ_i X. The value of the parent node n will be constructed as n = n_l + n_r * (β_i + δ_i X). Recurse over each
      * layer until the root is reached which will correspond to the perturbator polynomial F(X).
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/745): make computation of perturbator more memory
-     * efficient, operate in-place and use std::resize; add multithreading
+     *
+     * @details A node at level l is a polynomial of degree l, stored as its l + 1 coefficients. Level l has n / 2^l
+     * nodes, hence at most n coefficients, so the whole tree is computed in two preallocated buffers of size n holding
+     * the current and the previous level, with the nodes of a level laid out contiguously and computed in parallel.
+     * Since the full Honk relation vanishes on most rows, so do many subtrees, and a right child that is zero only
+     * requires copying its sibling.
      */
     static std::vector<FF> construct_perturbator_coefficients(const std::vector<FF>& betas,
                                                               const std::vector<FF>& deltas,
                                                               const std::vector<FF>& full_honk_evaluations)
     {
-        auto width = full_honk_evaluations.size();
-        std::vector<std::vector<FF>> first_level_coeffs(width >> 1, std::vector<FF>(2, 0));
-        for (size_t node = 0; node < width; node += 2) {
-            auto parent = node >> 1;
-            first_level_coeffs[parent][0] = full_honk_evaluations[node] + full_honk_evaluations[node + 1] * betas[0];
-            first_level_coeffs[parent][1] = full_honk_evaluations[node + 1] * deltas[0];
+        const size_t width = full_honk_evaluations.size();
+        const size_t log_width = betas.size();
+        ASSERT(width == (size_t(1) << log_width));
+
+        std::vector<FF> prev_level_coeffs(width);
+        std::vector<FF> level_coeffs(width);
+
+        // Each level is computed in parallel over its nodes, using fewer threads as the levels narrow
+        const auto compute_level = [](const size_t level_width, const auto& compute_node) {
+            const size_t num_threads = compute_num_threads(level_width);
+            const size_t nodes_per_thread = level_width / num_threads;
+            parallel_for(num_threads, [&](size_t thread_idx) {
+                for (size_t node = thread_idx * nodes_per_thread; node < (thread_idx + 1) * nodes_per_thread; node++) {
+                    compute_node(node);
+                }
+            });
+        };
+
+        // The first level is constructed from the leaves
+        compute_level(width >> 1, [&](const size_t parent) {
+            const FF& right = full_honk_evaluations[2 * parent + 1];
+            prev_level_coeffs[2 * parent] = full_honk_evaluations[2 * parent] + right * betas[0];
+            prev_level_coeffs[2 * parent + 1] = right * deltas[0];
+        });
+
+        // At each subsequent level, the parent nodes are polynomials of degree (level+1) because we multiply by an
+        // additional factor of X
+        for (size_t level = 1; level < log_width; level++) {
+            const size_t prev_num_coeffs = level + 1;
+            const size_t num_coeffs = level + 2;
+            compute_level(width >> (level + 1), [&](const size_t parent) {
+                const FF* left = &prev_level_coeffs[2 * parent * prev_num_coeffs];
+                const FF* right = left + prev_num_coeffs;
+                FF* result = &level_coeffs[parent * num_coeffs];
+
+                bool right_is_zero = true;
+                for (size_t d = 0; d < prev_num_coeffs; d++) {
+                    right_is_zero &= right[d].is_zero();
+                }
+                if (right_is_zero) {
+                    std::copy(left, left + prev_num_coeffs, result);
+                    result[prev_num_coeffs] = FF(0);
+                    return;
+                }
+
+                result[0] = left[0] + right[0] * betas[level];
+                for (size_t d = 1; d < prev_num_coeffs; d++) {
+                    result[d] = left[d] + right[d] * betas[level] + right[d - 1] * deltas[level];
+                }
+                result[prev_num_coeffs] = right[prev_num_coeffs - 1] * deltas[level];
+            });
+            std::swap(prev_level_coeffs, level_coeffs);
         }
-        return construct_coefficients_tree(betas, deltas, first_level_coeffs);
+
+        // The root, i.e. the coefficients of the perturbator polynomial
+        prev_level_coeffs.resize(log_width + 1);
+        return prev_level_coeffs;
     }
 
     /**
@@ -259,14 +358,28 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * polynomial, extract the value at row_idx. Use these values to create a univariate polynomial, and then extend
      * (i.e., compute additional evaluations at adjacent domain values) as needed.
      * @todo TODO(https://github.com/AztecProtocol/barretenberg/issues/751) Optimize memory
+     *
+     * @param polynomials_views The views of the prover polynomials of each instance, obtained once per thread
      */
-    void extend_univariates(ExtendedUnivariates& extended_univariates,
-                            const ProverInstances& instances,
-                            const size_t row_idx)
+    template <typename PolynomialsViews>
+    static void extend_univariates(ExtendedUnivariates& extended_univariates,
+                                   const PolynomialsViews& polynomials_views,
+                                   const size_t row_idx)
     {
-        auto base_univariates = instances.row_to_univariates(row_idx);
+        auto base_univariates = ProverInstances::row_to_univariates(polynomials_views, row_idx);
         for (auto [extended_univariate, base_univariate] : zip_view(extended_univariates.get_all(), base_univariates)) {
-            extended_univariate = base_univariate.template extend_to<ExtendedUnivariate::LENGTH>();
+            // A polynomial taking the same value in all instances, such as a selector of instances of the same circuit
+            // or a column that is zero outside some block, is constant in the folding variable and its extension is
+            // trivial. This saves the barycentric extension, whose cost grows with the number of instances.
+            const auto& base_evaluations = base_univariate.evaluations;
+            const bool is_constant = std::all_of(base_evaluations.begin() + 1,
+                                                 base_evaluations.end(),
+                                                 [&](const FF& value) { return value == base_evaluations[0]; });
+            if (is_constant) {
+                extended_univariate = ExtendedUnivariate(base_evaluations[0]);
+            } else {
+                extended_univariate = base_univariate.template extend_to<ExtendedUnivariate::LENGTH>();
+            }
         }
     }
 
@@ -277,8 +390,16 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
                                          const FF& scaling_factor)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        Relation::accumulate(
-            std::get<relation_idx>(univariate_accumulators), extended_univariates, relation_parameters, scaling_factor);
+        bool skip_relation = false;
+        if constexpr (isSkippable<Relation, ExtendedUnivariates>) {
+            skip_relation = Relation::skip(extended_univariates);
+        }
+        if (!skip_relation) {
+            Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
+                                 extended_univariates,
+                                 relation_parameters,
+                                 scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < Flavor::NUM_RELATIONS) {
@@ -297,15 +418,8 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         size_t common_instance_size = instances[0]->instance_size;
         pow_betas.compute_values();
         // Determine number of threads for multithreading.
-        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
-        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
-        size_t max_num_threads = get_num_cpus_pow2(); // number of available threads (power of 2)
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t desired_num_threads = common_instance_size / min_iterations_per_thread;
-        size_t num_threads = std::min(desired_num_threads, max_num_threads); // fewer than max if justified
-        num_threads = num_threads > 0 ? num_threads : 1;                     // ensure num threads is >= 1
-        size_t iterations_per_thread = common_instance_size / num_threads;   // actual iterations per thread
+        size_t num_threads = compute_num_threads(common_instance_size);
+        size_t iterations_per_thread = common_instance_size / num_threads; // actual iterations per thread
         // Construct univariate accumulator containers; one per thread
         std::vector<TupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
         for (auto& accum : thread_univariate_accumulators) {
@@ -321,10 +435,14 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         parallel_for(num_threads, [&](size_t thread_idx) {
             size_t start = thread_idx * iterations_per_thread;
             size_t end = (thread_idx + 1) * iterations_per_thread;
+            const auto polynomials_views = instances.get_polynomials_views();
 
             for (size_t idx = start; idx < end; idx++) {
+                if (row_is_zero(polynomials_views, idx)) {
+                    continue;
+                }
                 // No need to initialise extended_univariates to 0, it's assigned to
-                extend_univariates(extended_univariates[thread_idx], instances, idx);
+                extend_univariates(extended_univariates[thread_idx], polynomials_views, idx);
 
                 FF pow_challenge = pow_betas[idx];
 
@@ -371,9 +489,6 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     /**
      * @brief Compute the combiner quotient defined as $K$ polynomial in the paper.
      *
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/764): generalize the computation of vanishing
-     * polynomials and Lagrange basis and use batch_invert.
-     *
      */
     static Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, ProverInstances::NUM> compute_combiner_quotient(
         const FF compressed_perturbator, ExtendedUnivariateWithRandomization combiner)
@@ -384,11 +499,11 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         //
         for (size_t point = ProverInstances::NUM; point < combiner.size(); point++) {
             auto idx = point - ProverInstances::NUM;
-            auto lagrange_0 = FF(1) - FF(point);
-            auto vanishing_polynomial = FF(point) * (FF(point) - 1);
+            auto [lagranges, vanishing_polynomial] =
+                compute_lagranges_and_vanishing_polynomial<ProverInstances::NUM>(FF(point));
 
             combiner_quotient_evals[idx] =
-                (combiner.value_at(point) - compressed_perturbator * lagrange_0) * vanishing_polynomial.invert();
+                (combiner.value_at(point) - compressed_perturbator * lagranges[0]) * vanishing_polynomial.invert();
         }
 
         Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, ProverInstances::NUM> combiner_quotient(
@@ -135,8 +135,8 @@ std::shared_ptr<typename VerifierInstances::Instance> ProtoGalaxyVerifier_<Verif
     FF combiner_challenge = transcript->template get_challenge<FF>("combiner_quotient_challenge");
     auto combiner_quotient_at_challenge = combiner_quotient.evaluate(combiner_challenge);
 
-    auto vanishing_polynomial_at_challenge = combiner_challenge * (combiner_challenge - FF(1));
-    auto lagranges = std::vector<FF>{ FF(1) - combiner_challenge, combiner_challenge };
+    auto [lagranges, vanishing_polynomial_at_challenge] =
+        compute_lagranges_and_vanishing_polynomial<VerifierInstances::NUM>(combiner_challenge);
 
     auto next_accumulator = std::make_shared<Instance>();
     next_accumulator->instance_size = accumulator->instance_size;
@@ -216,4 +216,6 @@ std::shared_ptr<typename VerifierInstances::Instance> ProtoGalaxyVerifier_<Verif
 
 template class ProtoGalaxyVerifier_<VerifierInstances_<UltraFlavor, 2>>;
 template class ProtoGalaxyVerifier_<VerifierInstances_<GoblinUltraFlavor, 2>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<UltraFlavor, 4>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<GoblinUltraFlavor, 4>>;
 } // namespace bb
\ No newline at end of file
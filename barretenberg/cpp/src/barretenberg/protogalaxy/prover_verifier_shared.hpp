@@ -0,0 +1,43 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace bb {
+/**
+ * @brief Evaluate, at a challenge γ, the Lagrange basis {L_0, ..., L_{k}} of the domain {0, 1, ..., k} on which k + 1
+ * instances are folded, together with the polynomial Z(X) = X(X - 1)...(X - k) vanishing on that domain.
+ *
+ * @details These are used by both the folding prover and verifier to fold the instances into ∑_i L_i(γ)·ω_i and to
+ * compute the next target sum F(α)·L_0(γ) + Z(γ)·K(γ). For two instances this reduces to {1 - γ, γ} and γ(γ - 1).
+ *
+ * @tparam NUM The number of instances, k + 1
+ * @return The Lagrange basis evaluations and the evaluation of the vanishing polynomial
+ */
+template <size_t NUM, typename FF>
+std::pair<std::array<FF, NUM>, FF> compute_lagranges_and_vanishing_polynomial(const FF& challenge)
+{
+    static_assert(NUM > 1, "Must have at least two instances");
+    std::array<FF, NUM> challenge_minus_points;
+    FF vanishing_polynomial_at_challenge(1);
+    for (size_t i = 0; i < NUM; i++) {
+        challenge_minus_points[i] = challenge - FF(i);
+        vanishing_polynomial_at_challenge *= challenge_minus_points[i];
+    }
+
+    // L_j(γ) = ∏_{i ≠ j} (γ - i) / (j - i)
+    std::array<FF, NUM> lagranges;
+    for (size_t j = 0; j < NUM; j++) {
+        FF numerator(1);
+        FF denominator(1);
+        for (size_t i = 0; i < NUM; i++) {
+            if (i != j) {
+                numerator *= challenge_minus_points[i];
+                denominator *= FF(j) - FF(i);
+            }
+        }
+        lagranges[j] = numerator * denominator.invert();
+    }
+    return { lagranges, vanishing_polynomial_at_challenge };
+}
+} // namespace bb
@@ -49,6 +49,12 @@ template <typename FF_> class AuxiliaryRelationImpl {
         6  // RAM consistency sub-relation 3
     };
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in) { return in.q_aux.is_zero(); }
+
     /**
      * @brief Expression for the generalized permutation sort gate.
      * @details The following explanation is reproduced from the Plonk analog 'plookup_auxiliary_widget':
@@ -118,6 +124,12 @@ template <typename FF_> class AuxiliaryRelationImpl {
         const FF LIMB_SIZE(uint256_t(1) << 68);
         const FF SUBLIMB_SHIFT(uint256_t(1) << 14);
 
+        // Selector products shared by several subrelations
+        auto q_aux_by_scaling = q_aux * scaling_factor;
+        auto q_one_by_two = q_1 * q_2;
+        auto q_one_by_two_by_aux_by_scaling = q_one_by_two * q_aux_by_scaling;
+        auto q_arith_by_aux_by_scaling = q_arith * q_aux_by_scaling;
+
         /**
          * Non native field arithmetic gate 2
          * deg 4
@@ -247,13 +259,14 @@ template <typename FF_> class AuxiliaryRelationImpl {
 
         auto index_is_monotonically_increasing = index_delta * index_delta - index_delta; // deg 2
 
-        auto adjacent_values_match_if_adjacent_indices_match = (index_delta * FF(-1) + FF(1)) * record_delta; // deg 2
+        auto index_delta_is_zero = index_delta * FF(-1) + FF(1); // 1 - index_delta, deg 1
+
+        auto adjacent_values_match_if_adjacent_indices_match = index_delta_is_zero * record_delta; // deg 2
 
         std::get<1>(accumulators) +=
-            adjacent_values_match_if_adjacent_indices_match * (q_1 * q_2) * (q_aux * scaling_factor); // deg 5
-        std::get<2>(accumulators) +=
-            index_is_monotonically_increasing * (q_1 * q_2) * (q_aux * scaling_factor); // deg 5
-        auto ROM_consistency_check_identity = memory_record_check * (q_1 * q_2);        // deg 3 or 7
+            adjacent_values_match_if_adjacent_indices_match * q_one_by_two_by_aux_by_scaling; // deg 5
+        std::get<2>(accumulators) += index_is_monotonically_increasing * q_one_by_two_by_aux_by_scaling; // deg 5
+        auto ROM_consistency_check_identity = memory_record_check * q_one_by_two;                        // deg 3 or 7
 
         /**
          * RAM Consistency Check
@@ -288,7 +301,7 @@ template <typename FF_> class AuxiliaryRelationImpl {
 
         auto value_delta = w_3_shift - w_3;
         auto adjacent_values_match_if_adjacent_indices_match_and_next_access_is_a_read_operation =
-            (index_delta * FF(-1) + FF(1)) * value_delta * (next_gate_access_type * FF(-1) + FF(1)); // deg 3 or 6
+            index_delta_is_zero * value_delta * (next_gate_access_type * FF(-1) + FF(1)); // deg 3 or 6
 
         // We can't apply the RAM consistency check identity on the final entry in the sorted list (the wires in the
         // next gate would make the identity fail).  We need to validate that its 'access type' bool is correct. Can't
@@ -299,12 +312,11 @@ template <typename FF_> class AuxiliaryRelationImpl {
 
         // Putting it all together...
         std::get<3>(accumulators) +=
-            adjacent_values_match_if_adjacent_indices_match_and_next_access_is_a_read_operation * (q_arith) *
-            (q_aux * scaling_factor); // deg 5 or 8
-        std::get<4>(accumulators) += index_is_monotonically_increasing * (q_arith) * (q_aux * scaling_factor); // deg 4
-        std::get<5>(accumulators) +=
-            next_gate_access_type_is_boolean * (q_arith) * (q_aux * scaling_factor); // deg 4 or 6
-        auto RAM_consistency_check_identity = access_check * (q_arith);              // deg 3 or 9
+            adjacent_values_match_if_adjacent_indices_match_and_next_access_is_a_read_operation *
+            q_arith_by_aux_by_scaling;                                                                // deg 5 or 8
+        std::get<4>(accumulators) += index_is_monotonically_increasing * q_arith_by_aux_by_scaling; // deg 4
+        std::get<5>(accumulators) += next_gate_access_type_is_boolean * q_arith_by_aux_by_scaling;  // deg 4 or 6
+        auto RAM_consistency_check_identity = access_check * (q_arith);                             // deg 3 or 9
 
         /**
          * RAM Timestamp Consistency Check
@@ -318,7 +330,7 @@ template <typename FF_> class AuxiliaryRelationImpl {
          * Else timestamp_check = 0
          */
         auto timestamp_delta = w_2_shift - w_2;
-        auto RAM_timestamp_check_identity = (index_delta * FF(-1) + FF(1)) * timestamp_delta - w_3; // deg 3
+        auto RAM_timestamp_check_identity = index_delta_is_zero * timestamp_delta - w_3; // deg 3
 
         /**
          * The complete RAM/ROM memory identity
@@ -331,7 +343,7 @@ template <typename FF_> class AuxiliaryRelationImpl {
 
         // (deg 3 or 9) + (deg 4) + (deg 3)
         auto auxiliary_identity = memory_identity + non_native_field_identity + limb_accumulator_identity;
-        auxiliary_identity *= (q_aux * scaling_factor); // deg 4 or 10
+        auxiliary_identity *= q_aux_by_scaling; // deg 4 or 10
         std::get<0>(accumulators) += auxiliary_identity;
     };
 };
@@ -26,6 +26,12 @@ template <typename FF_> class EllipticRelationImpl {
         }
     }
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in) { return in.q_elliptic.is_zero(); }
+
     /**
      * @brief Expression for the Ultra Arithmetic gate.
      * @details The relation is defined as C(in(X)...) =
@@ -60,6 +66,11 @@ template <typename FF_> class EllipticRelationImpl {
         auto q_elliptic = View(in.q_elliptic);
         auto q_is_double = View(in.q_m);
 
+        // The addition and doubling identities are gated by q_elliptic * (1 - q_is_double) and q_elliptic * q_is_double
+        auto q_elliptic_by_scaling = q_elliptic * scaling_factor;
+        auto q_elliptic_q_double_by_scaling = q_elliptic_by_scaling * q_is_double;
+        auto q_elliptic_not_double_by_scaling = q_elliptic_by_scaling - q_elliptic_q_double_by_scaling;
+
         // Contribution (1) point addition, x-coordinate check
         // q_elliptic * (x3 + x2 + x1)(x2 - x1)(x2 - x1) - y2^2 - y1^2 + 2(y2y1)*q_sign = 0
         auto x_diff = (x_2 - x_1);
@@ -67,14 +78,14 @@ template <typename FF_> class EllipticRelationImpl {
         auto y1_sqr = (y_1 * y_1);
         auto y1y2 = y_1 * y_2 * q_sign;
         auto x_add_identity = (x_3 + x_2 + x_1) * x_diff * x_diff - y2_sqr - y1_sqr + y1y2 + y1y2;
-        std::get<0>(accumulators) += x_add_identity * scaling_factor * q_elliptic * (-q_is_double + 1);
+        std::get<0>(accumulators) += x_add_identity * q_elliptic_not_double_by_scaling;
 
         // Contribution (2) point addition, x-coordinate check
         // q_elliptic * (q_sign * y1 + y3)(x2 - x1) + (x3 - x1)(y2 - q_sign * y1) = 0
         auto y1_plus_y3 = y_1 + y_3;
         auto y_diff = y_2 * q_sign - y_1;
         auto y_add_identity = y1_plus_y3 * x_diff + (x_3 - x_1) * y_diff;
-        std::get<1>(accumulators) += y_add_identity * scaling_factor * q_elliptic * (-q_is_double + 1);
+        std::get<1>(accumulators) += y_add_identity * q_elliptic_not_double_by_scaling;
 
         // Contribution (3) point doubling, x-coordinate check
         // (x3 + x1 + x1) (4y1*y1) - 9 * x1 * x1 * x1 * x1 = 0
@@ -85,13 +96,13 @@ template <typename FF_> class EllipticRelationImpl {
         y1_sqr_mul_4 += y1_sqr_mul_4;
         auto x1_pow_4_mul_9 = x_pow_4 * 9;
         auto x_double_identity = (x_3 + x_1 + x_1) * y1_sqr_mul_4 - x1_pow_4_mul_9;
-        std::get<0>(accumulators) += x_double_identity * scaling_factor * q_elliptic * q_is_double;
+        std::get<0>(accumulators) += x_double_identity * q_elliptic_q_double_by_scaling;
 
         // Contribution (4) point doubling, y-coordinate check
         // (y1 + y1) (2y1) - (3 * x1 * x1)(x1 - x3) = 0
         auto x1_sqr_mul_3 = (x_1 + x_1 + x_1) * x_1;
         auto y_double_identity = x1_sqr_mul_3 * (x_1 - x_3) - (y_1 + y_1) * (y_1 + y_3);
-        std::get<1>(accumulators) += y_double_identity * scaling_factor * q_elliptic * q_is_double;
+        std::get<1>(accumulators) += y_double_identity * q_elliptic_q_double_by_scaling;
     };
 };
 
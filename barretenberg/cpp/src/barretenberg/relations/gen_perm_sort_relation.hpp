@@ -14,6 +14,12 @@ template <typename FF_> class GenPermSortRelationImpl {
         6  // range constrain sub-relation 4
     };
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in) { return in.q_sort.is_zero(); }
+
     /**
      * @brief Expression for the generalized permutation sort gate.
      * @details The relation is defined as C(in(X)...) =
@@ -44,9 +50,10 @@ template <typename FF_> class GenPermSortRelationImpl {
         auto w_1_shift = View(in.w_l_shift);
         auto q_sort = View(in.q_sort);
 
-        static const FF minus_one = FF(-1);
-        static const FF minus_two = FF(-2);
         static const FF minus_three = FF(-3);
+        static const FF two = FF(2);
+
+        auto q_sort_by_scaling = q_sort * scaling_factor;
 
         // Compute wire differences
         auto delta_1 = w_2 - w_1;
@@ -54,40 +61,31 @@ template <typename FF_> class GenPermSortRelationImpl {
         auto delta_3 = w_4 - w_3;
         auto delta_4 = w_1_shift - w_4;
 
+        // Each range constraint D(D - 1)(D - 2)(D - 3) is computed as D(D - 3) * (D(D - 3) + 2), which takes two
+        // multiplications rather than three
+
         // Contribution (1)
-        auto tmp_1 = delta_1;
-        tmp_1 *= (delta_1 + minus_one);
-        tmp_1 *= (delta_1 + minus_two);
-        tmp_1 *= (delta_1 + minus_three);
-        tmp_1 *= q_sort;
-        tmp_1 *= scaling_factor;
+        auto tmp_1 = delta_1 * (delta_1 + minus_three);
+        tmp_1 *= (tmp_1 + two);
+        tmp_1 *= q_sort_by_scaling;
         std::get<0>(accumulators) += tmp_1;
 
         // Contribution (2)
-        auto tmp_2 = delta_2;
-        tmp_2 *= (delta_2 + minus_one);
-        tmp_2 *= (delta_2 + minus_two);
-        tmp_2 *= (delta_2 + minus_three);
-        tmp_2 *= q_sort;
-        tmp_2 *= scaling_factor;
+        auto tmp_2 = delta_2 * (delta_2 + minus_three);
+        tmp_2 *= (tmp_2 + two);
+        tmp_2 *= q_sort_by_scaling;
         std::get<1>(accumulators) += tmp_2;
 
         // Contribution (3)
-        auto tmp_3 = delta_3;
-        tmp_3 *= (delta_3 + minus_one);
-        tmp_3 *= (delta_3 + minus_two);
-        tmp_3 *= (delta_3 + minus_three);
-        tmp_3 *= q_sort;
-        tmp_3 *= scaling_factor;
+        auto tmp_3 = delta_3 * (delta_3 + minus_three);
+        tmp_3 *= (tmp_3 + two);
+        tmp_3 *= q_sort_by_scaling;
         std::get<2>(accumulators) += tmp_3;
 
         // Contribution (4)
-        auto tmp_4 = delta_4;
-        tmp_4 *= (delta_4 + minus_one);
-        tmp_4 *= (delta_4 + minus_two);
-        tmp_4 *= (delta_4 + minus_three);
-        tmp_4 *= q_sort;
-        tmp_4 *= scaling_factor;
+        auto tmp_4 = delta_4 * (delta_4 + minus_three);
+        tmp_4 *= (tmp_4 + two);
+        tmp_4 *= q_sort_by_scaling;
         std::get<3>(accumulators) += tmp_4;
     };
 };
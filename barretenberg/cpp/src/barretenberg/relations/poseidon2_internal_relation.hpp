@@ -15,6 +15,15 @@ template <typename FF_> class Poseidon2InternalRelationImpl {
         7, // internal poseidon2 round sub-relation for fourth value
     };
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in)
+    {
+        return in.q_poseidon2_internal.is_zero();
+    }
+
     /**
      * @brief Expression for the poseidon2 internal round relation, based on I_i in Section 6 of
      * https://eprint.iacr.org/2023/323.pdf.
@@ -52,6 +61,7 @@ template <typename FF_> class Poseidon2InternalRelationImpl {
         auto w_4_shift = View(in.w_4_shift);
         auto q_l = View(in.q_l);
         auto q_poseidon2_internal = View(in.q_poseidon2_internal);
+        auto q_pos_by_scaling = q_poseidon2_internal * scaling_factor;
 
         // add round constants
         auto s1 = w_l + q_l;
@@ -69,26 +79,22 @@ template <typename FF_> class Poseidon2InternalRelationImpl {
 
         auto v1 = u1 * crypto::Poseidon2Bn254ScalarFieldParams::internal_matrix_diagonal[0];
         v1 += sum;
-        auto tmp = q_poseidon2_internal * (v1 - w_l_shift);
-        tmp *= scaling_factor;
+        auto tmp = q_pos_by_scaling * (v1 - w_l_shift);
         std::get<0>(evals) += tmp;
 
         auto v2 = u2 * crypto::Poseidon2Bn254ScalarFieldParams::internal_matrix_diagonal[1];
         v2 += sum;
-        tmp = q_poseidon2_internal * (v2 - w_r_shift);
-        tmp *= scaling_factor;
+        tmp = q_pos_by_scaling * (v2 - w_r_shift);
         std::get<1>(evals) += tmp;
 
         auto v3 = u3 * crypto::Poseidon2Bn254ScalarFieldParams::internal_matrix_diagonal[2];
         v3 += sum;
-        tmp = q_poseidon2_internal * (v3 - w_o_shift);
-        tmp *= scaling_factor;
+        tmp = q_pos_by_scaling * (v3 - w_o_shift);
         std::get<2>(evals) += tmp;
 
         auto v4 = u4 * crypto::Poseidon2Bn254ScalarFieldParams::internal_matrix_diagonal[3];
         v4 += sum;
-        tmp = q_poseidon2_internal * (v4 - w_4_shift);
-        tmp *= scaling_factor;
+        tmp = q_pos_by_scaling * (v4 - w_4_shift);
         std::get<3>(evals) += tmp;
     };
 }; // namespace bb
@@ -31,6 +31,17 @@ concept HasSubrelationLinearlyIndependentMember = requires(T) {
 template <typename T>
 concept HasParameterLengthAdjustmentsMember = requires { T::TOTAL_LENGTH_ADJUSTMENTS; };
 
+/**
+ * @brief Check whether a relation provides a cheap test, typically on its gate selector, for its contribution at a row
+ * being identically zero, so that callers can avoid evaluating it there.
+ */
+template <typename Relation, typename AllEntities>
+concept isSkippable = requires(const AllEntities& input) {
+                          {
+                              Relation::skip(input)
+                              } -> std::same_as<bool>;
+                      };
+
 /**
  * @brief Check whether a given subrelation is linearly independent from the other subrelations.
  *
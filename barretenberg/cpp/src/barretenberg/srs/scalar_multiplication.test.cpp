@@ -1040,3 +1040,36 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerMulByZero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TYPED_TEST(ScalarMultiplicationTests, Straus)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    for (const size_t num_points : { 0UL, 1UL, 17UL }) {
+        std::vector<Fr> scalars(num_points);
+        std::vector<AffineElement> points(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            scalars[i] = Fr::random_element();
+            points[i] = AffineElement(Element::random_element());
+        }
+        // Include a zero scalar, a point at infinity and a repeated point
+        if (num_points > 1) {
+            scalars[0] = Fr::zero();
+            points[num_points - 1] = AffineElement::infinity();
+            points[1] = points[0];
+        }
+
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected += points[i] * scalars[i];
+        }
+
+        Element result = scalar_multiplication::straus<Curve>(scalars.data(), points.data(), num_points);
+
+        EXPECT_EQ(result.normalize(), expected.normalize());
+    }
+}
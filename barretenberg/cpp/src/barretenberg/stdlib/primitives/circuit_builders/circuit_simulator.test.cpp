@@ -0,0 +1,166 @@
+#include "barretenberg/proof_system/circuit_builder/circuit_simulator.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/stdlib/primitives/bool/bool.hpp"
+#include "barretenberg/stdlib/primitives/curves/bn254.hpp"
+#include "barretenberg/stdlib/primitives/field/field.hpp"
+#include "barretenberg/stdlib/primitives/safe_uint/safe_uint.hpp"
+#include "barretenberg/stdlib/primitives/witness/witness.hpp"
+#include "circuit_builders.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+/**
+ * @brief A small gadget exercising field, bool and safe_uint arithmetic, generic over the builder it is executed on
+ */
+template <typename Builder> std::vector<fr> run_gadget(Builder& builder, const std::array<fr, 3>& inputs, bool& valid)
+{
+    using field_ct = stdlib::field_t<Builder>;
+    using witness_ct = stdlib::witness_t<Builder>;
+    using bool_ct = stdlib::bool_t<Builder>;
+    using suint_ct = stdlib::safe_uint_t<Builder>;
+
+    field_ct a(witness_ct(&builder, inputs[0]));
+    field_ct b(witness_ct(&builder, inputs[1]));
+    field_ct c = stdlib::public_witness_t<Builder>(&builder, inputs[2]);
+
+    field_ct d = a.madd(b, c) * (a + 5) - b / c;
+    field_ct e = field_ct::accumulate({ a, b, c, d });
+    bool_ct is_equal = (d == e);
+    field_ct f = field_ct::conditional_assign(is_equal, a, e.sqr());
+    d.assert_not_equal(c);
+
+    suint_ct x(witness_ct(&builder, 1000), 10);
+    suint_ct y(witness_ct(&builder, 24), 10);
+    suint_ct z = x + y;
+    z.value.create_range_constraint(11);
+
+    valid = builder.check_circuit();
+    return { d.get_value(), e.get_value(), f.get_value(), z.get_value(), field_ct(is_equal).get_value() };
+}
+
+/**
+ * @brief A gadget exercising bigfield and biggroup, which rely on lookups, ROM tables and the non-native field methods
+ */
+template <typename Builder>
+std::vector<fq> run_curve_gadget(Builder& builder,
+                                 const std::array<fq, 2>& inputs,
+                                 const g1::affine_element& point,
+                                 const fr& scalar,
+                                 bool& valid)
+{
+    using Curve = stdlib::bn254<Builder>;
+    using fq_ct = typename Curve::BaseField;
+    using element_ct = typename Curve::Group;
+    using scalar_ct = typename Curve::ScalarField;
+
+    fq_ct a = fq_ct::from_witness(&builder, inputs[0]);
+    fq_ct b = fq_ct::from_witness(&builder, inputs[1]);
+    fq_ct c = (a * b + a - b) / a;
+    c.self_reduce();
+
+    element_ct P = element_ct::from_witness(&builder, point);
+    element_ct Q = P.dbl() + P;
+    element_ct R = P * scalar_ct::from_witness(&builder, scalar);
+
+    valid = builder.check_circuit();
+    const auto q_value = Q.get_value();
+    const auto r_value = R.get_value();
+    return { fq(c.get_value().lo), q_value.x, q_value.y, r_value.x, r_value.y };
+}
+} // namespace
+
+/**
+ * @brief Simulating a gadget yields the same values as building it, without recording any gates
+ */
+TEST(CircuitSimulator, MatchesCircuitBuilder)
+{
+    const std::array<fr, 3> inputs{ fr::random_element(&engine), fr::random_element(&engine), fr(7) };
+
+    UltraCircuitBuilder builder;
+    bool builder_valid = false;
+    const auto expected = run_gadget(builder, inputs, builder_valid);
+
+    CircuitSimulatorBN254 simulator;
+    bool simulator_valid = false;
+    const auto result = run_gadget(simulator, inputs, simulator_valid);
+
+    EXPECT_TRUE(builder_valid);
+    EXPECT_TRUE(simulator_valid);
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(simulator.get_public_inputs(), builder.get_public_inputs());
+    EXPECT_EQ(simulator.get_num_gates(), 0);
+    EXPECT_LT(simulator.get_num_variables(), builder.get_num_variables());
+}
+
+/**
+ * @brief Non-native field and group arithmetic produce the same values on the simulator as on UltraCircuitBuilder
+ */
+TEST(CircuitSimulator, BigfieldBiggroupMatchCircuitBuilder)
+{
+    const std::array<fq, 2> inputs{ fq::random_element(&engine), fq::random_element(&engine) };
+    const g1::affine_element point(g1::element::random_element(&engine));
+    const fr scalar = fr::random_element(&engine);
+
+    UltraCircuitBuilder builder;
+    bool builder_valid = false;
+    const auto expected = run_curve_gadget(builder, inputs, point, scalar, builder_valid);
+
+    CircuitSimulatorBN254 simulator;
+    bool simulator_valid = false;
+    const auto result = run_curve_gadget(simulator, inputs, point, scalar, simulator_valid);
+
+    EXPECT_TRUE(builder_valid);
+    EXPECT_TRUE(simulator_valid);
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(expected[1], fq(g1::affine_element(g1::element(point) * fr(3)).x));
+    EXPECT_EQ(expected[3], fq(g1::affine_element(g1::element(point) * scalar).x));
+}
+
+/**
+ * @brief Unsatisfiable constraints are reported by the simulator as they are created
+ */
+TEST(CircuitSimulator, DetectsFailures)
+{
+    using field_ct = stdlib::field_t<CircuitSimulatorBN254>;
+    using witness_ct = stdlib::witness_t<CircuitSimulatorBN254>;
+    using bool_ct = stdlib::bool_t<CircuitSimulatorBN254>;
+
+    {
+        CircuitSimulatorBN254 simulator;
+        field_ct a(witness_ct(&simulator, 3));
+        field_ct b(witness_ct(&simulator, 4));
+        (a * b).assert_equal(field_ct(13), "product mismatch");
+        EXPECT_TRUE(simulator.failed());
+        EXPECT_EQ(simulator.err(), "product mismatch");
+    }
+    {
+        CircuitSimulatorBN254 simulator;
+        field_ct a(witness_ct(&simulator, 1 << 12));
+        a.create_range_constraint(12, "range");
+        EXPECT_FALSE(simulator.check_circuit());
+        EXPECT_EQ(simulator.err(), "range");
+    }
+    {
+        CircuitSimulatorBN254 simulator;
+        // Forge a non-boolean witness behind the back of bool_t
+        bool_ct a(witness_ct(&simulator, true));
+        simulator.variables[a.witness_index] = fr(2);
+        simulator.create_bool_gate(a.witness_index);
+        EXPECT_TRUE(simulator.failed());
+    }
+    {
+        using fq_ct = stdlib::bn254<CircuitSimulatorBN254>::BaseField;
+        CircuitSimulatorBN254 simulator;
+        // Forge a prime basis limb that disagrees with the binary basis limbs; only the multiplication can catch it
+        fq_ct a = fq_ct::from_witness(&simulator, fq(5));
+        fq_ct b = fq_ct::from_witness(&simulator, fq(7));
+        EXPECT_FALSE(simulator.failed());
+        simulator.variables[a.prime_basis_limb.witness_index] = fr(6);
+        [[maybe_unused]] fq_ct c = a * b;
+        EXPECT_TRUE(simulator.failed());
+    }
+}
@@ -274,4 +274,5 @@ template <typename Builder> void DynamicArray<Builder>::conditional_pop(const bo
 
 template class DynamicArray<bb::UltraCircuitBuilder>;
 template class DynamicArray<bb::GoblinUltraCircuitBuilder>;
+template class DynamicArray<bb::CircuitSimulatorBN254>;
 } // namespace bb::stdlib
\ No newline at end of file
@@ -253,4 +253,5 @@ template <typename Builder> void ram_table<Builder>::write(const field_pt& index
 
 template class ram_table<bb::UltraCircuitBuilder>;
 template class ram_table<bb::GoblinUltraCircuitBuilder>;
+template class ram_table<bb::CircuitSimulatorBN254>;
 } // namespace bb::stdlib
\ No newline at end of file
@@ -123,4 +123,5 @@ template <typename Builder> field_t<Builder> rom_table<Builder>::operator[](cons
 
 template class rom_table<bb::UltraCircuitBuilder>;
 template class rom_table<bb::GoblinUltraCircuitBuilder>;
+template class rom_table<bb::CircuitSimulatorBN254>;
 } // namespace bb::stdlib
\ No newline at end of file
@@ -140,4 +140,5 @@ std::array<field_t<Builder>, 2> twin_rom_table<Builder>::operator[](const field_
 
 template class twin_rom_table<bb::UltraCircuitBuilder>;
 template class twin_rom_table<bb::GoblinUltraCircuitBuilder>;
+template class twin_rom_table<bb::CircuitSimulatorBN254>;
 } // namespace bb::stdlib
\ No newline at end of file
@@ -92,4 +92,5 @@ field_t<Builder> plookup_read<Builder>::read_from_1_to_2_table(const MultiTableI
 
 template class plookup_read<bb::UltraCircuitBuilder>;
 template class plookup_read<bb::GoblinUltraCircuitBuilder>;
+template class plookup_read<bb::CircuitSimulatorBN254>;
 } // namespace bb::stdlib
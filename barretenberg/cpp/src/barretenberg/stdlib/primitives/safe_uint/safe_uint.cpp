@@ -241,5 +241,6 @@ std::array<safe_uint_t<Builder>, 3> safe_uint_t<Builder>::slice(const uint8_t ms
 template class safe_uint_t<bb::StandardCircuitBuilder>;
 template class safe_uint_t<bb::UltraCircuitBuilder>;
 template class safe_uint_t<bb::GoblinUltraCircuitBuilder>;
+template class safe_uint_t<bb::CircuitSimulatorBN254>;
 
 } // namespace bb::stdlib
@@ -50,6 +50,11 @@ template <typename Builder> struct StdlibTranscriptParams {
         Builder* builder = element.get_context();
         return bb::stdlib::field_conversion::convert_to_bn254_frs<Builder, T>(*builder, element);
     }
+    template <typename T> static inline void append_to_bn254_frs(const T& element, Proof& proof_data)
+    {
+        auto element_frs = convert_to_bn254_frs(element);
+        proof_data.insert(proof_data.end(), element_frs.begin(), element_frs.end());
+    }
 };
 
 using UltraStdlibTranscript = BaseTranscript<StdlibTranscriptParams<UltraCircuitBuilder>>;
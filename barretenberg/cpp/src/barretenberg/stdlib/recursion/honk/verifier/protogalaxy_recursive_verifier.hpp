@@ -41,6 +41,12 @@ template <class VerifierInstances> class ProtoGalaxyRecursiveVerifier_ {
         : builder(builder)
         , instances(VerifierInstances(builder, accumulator, native_inst_vks)){};
 
+    ProtoGalaxyRecursiveVerifier_(Builder* builder,
+                                  std::shared_ptr<NativeInstance>& accumulator,
+                                  const std::vector<std::shared_ptr<VerificationKey>>& inst_vks)
+        : builder(builder)
+        , instances(VerifierInstances(builder, accumulator, inst_vks)){};
+
     /**
      * @brief Given a new round challenge δ for each iteration of the full ProtoGalaxy protocol, compute the vector
      * [δ, δ^2,..., δ^t] where t = logn and n is the size of the instance.
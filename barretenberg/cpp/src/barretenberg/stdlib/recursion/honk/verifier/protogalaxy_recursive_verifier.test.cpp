@@ -213,6 +213,50 @@ template <typename RecursiveFlavor> class ProtoGalaxyRecursiveTests : public tes
         }
     };
 
+    /**
+     * @brief Fold an instance whose verification key is passed to the recursive verifier as constants and check that
+     * the circuit is satisfied and smaller than when the key is converted to witnesses
+     *
+     */
+    static void test_recursive_folding_with_constant_key()
+    {
+        Builder builder1;
+        create_function_circuit(builder1);
+        Builder builder2;
+        builder2.add_public_variable(FF(1));
+        create_function_circuit(builder2);
+
+        Composer composer = Composer();
+        auto prover_instance_1 = composer.create_prover_instance(builder1);
+        auto verifier_instance_1 = composer.create_verifier_instance(prover_instance_1);
+        auto prover_instance_2 = composer.create_prover_instance(builder2);
+        auto verifier_instance_2 = composer.create_verifier_instance(prover_instance_2);
+        auto folding_prover = composer.create_folding_prover({ prover_instance_1, prover_instance_2 });
+        auto folding_proof = folding_prover.fold_instances();
+
+        Builder witness_key_circuit;
+        auto witness_key_verifier = FoldingRecursiveVerifier(
+            &witness_key_circuit, verifier_instance_1, { verifier_instance_2->verification_key });
+        witness_key_verifier.verify_folding_proof(folding_proof.folding_data);
+
+        Builder constant_key_circuit;
+        auto constant_key = RecursiveFlavor::VerificationKey::from_constants(&constant_key_circuit,
+                                                                              verifier_instance_2->verification_key);
+        auto constant_key_verifier =
+            FoldingRecursiveVerifier(&constant_key_circuit, verifier_instance_1, { constant_key });
+        auto recursive_verifier_acc = constant_key_verifier.verify_folding_proof(folding_proof.folding_data);
+        info("Folding Recursive Verifier: num gates = ",
+             witness_key_circuit.num_gates,
+             " with a witness key, ",
+             constant_key_circuit.num_gates,
+             " with a constant key");
+
+        EXPECT_EQ(recursive_verifier_acc->target_sum.get_value(), folding_proof.accumulator->target_sum);
+        EXPECT_LT(constant_key_circuit.num_gates, witness_key_circuit.num_gates);
+        EXPECT_EQ(constant_key_circuit.failed(), false) << constant_key_circuit.err();
+        EXPECT_TRUE(constant_key_circuit.check_circuit());
+    };
+
     /**
      * @brief Perform two rounds of folding valid circuits and then recursive verify the final decider proof,
      * make sure the verifer circuits pass check_circuit(). Ensure that the algorithm of the recursive and native
@@ -375,6 +419,11 @@ TYPED_TEST(ProtoGalaxyRecursiveTests, RecursiveFoldingTest)
     TestFixture::test_recursive_folding();
 }
 
+TYPED_TEST(ProtoGalaxyRecursiveTests, RecursiveFoldingWithConstantKeyTest)
+{
+    TestFixture::test_recursive_folding_with_constant_key();
+}
+
 TYPED_TEST(ProtoGalaxyRecursiveTests, FullProtogalaxyRecursiveTest)
 {
 
@@ -39,5 +39,27 @@ template <IsRecursiveFlavor Flavor_, size_t NUM_> struct RecursiveVerifierInstan
             idx++;
         }
     }
+
+    /**
+     * @brief Construct the instances to fold from stdlib keys already built in this builder (e.g. by
+     * VerificationKey::from_constants) instead of converting native keys to witnesses again
+     */
+    RecursiveVerifierInstances_(Builder* builder,
+                                const std::shared_ptr<NativeInstance>& accumulator,
+                                const std::vector<std::shared_ptr<VerificationKey>>& vks)
+        : builder(builder)
+    {
+        ASSERT(vks.size() == NUM - 1);
+        if (accumulator->is_accumulator) {
+            _data[0] = std::make_shared<Instance>(builder, accumulator);
+        } else {
+            _data[0] = std::make_shared<Instance>(builder, accumulator->verification_key);
+        }
+        size_t idx = 1;
+        for (auto& vk : vks) {
+            _data[idx] = std::make_shared<Instance>(builder, vk);
+            idx++;
+        }
+    }
 };
 } // namespace bb::stdlib::recursion::honk
@@ -47,6 +47,10 @@ template <IsRecursiveFlavor Flavor> class RecursiveVerifierInstance_ {
         : builder(builder)
         , verification_key(std::make_shared<VerificationKey>(builder, vk))
     {}
+    RecursiveVerifierInstance_(Builder* builder, std::shared_ptr<VerificationKey> vk)
+        : builder(builder)
+        , verification_key(std::move(vk))
+    {}
 
     RecursiveVerifierInstance_(Builder* builder, const std::shared_ptr<VerifierInstance>& instance)
         : pub_inputs_offset((instance->pub_inputs_offset))
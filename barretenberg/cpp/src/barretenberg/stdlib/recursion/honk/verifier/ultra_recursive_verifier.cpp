@@ -13,6 +13,13 @@ UltraRecursiveVerifier_<Flavor>::UltraRecursiveVerifier_(
     , builder(builder)
 {}
 
+template <typename Flavor>
+UltraRecursiveVerifier_<Flavor>::UltraRecursiveVerifier_(Builder* builder,
+                                                         const std::shared_ptr<VerificationKey>& verifier_key)
+    : key(verifier_key)
+    , builder(builder)
+{}
+
 /**
  * @brief This function constructs a recursive verifier circuit for an Ultra Honk proof of a given flavor.
  *
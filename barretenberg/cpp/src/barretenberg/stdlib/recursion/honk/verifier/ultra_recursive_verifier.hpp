@@ -21,6 +21,8 @@ template <typename Flavor> class UltraRecursiveVerifier_ {
 
     explicit UltraRecursiveVerifier_(Builder* builder,
                                      const std::shared_ptr<NativeVerificationKey>& native_verifier_key);
+    // Reuse a stdlib key that has already been constructed in this builder (see VerificationKey::from_constants)
+    explicit UltraRecursiveVerifier_(Builder* builder, const std::shared_ptr<VerificationKey>& verifier_key);
 
     // TODO(luke): Eventually this will return something like aggregation_state but I'm simplifying for now until we
     // determine the exact interface. Simply returns the two pairing points.
@@ -202,6 +202,51 @@ template <typename BuilderType> class RecursiveVerifierTest : public testing::Te
         }
     }
 
+    /**
+     * @brief Recursively verify two proofs of the same circuit against one verification key built from constants, and
+     * check that this is cheaper than converting the key to witnesses for each verification
+     *
+     */
+    static void test_recursive_verification_with_constant_key()
+    {
+        // Create an arbitrary inner circuit
+        InnerBuilder inner_circuit;
+        create_inner_circuit(inner_circuit);
+
+        // Generate a proof over the inner circuit
+        InnerComposer inner_composer;
+        auto instance = inner_composer.create_prover_instance(inner_circuit);
+        auto inner_prover = inner_composer.create_prover(instance);
+        auto inner_proof = inner_prover.construct_proof();
+        auto native_verifier = inner_composer.create_verifier(instance->verification_key);
+
+        OuterBuilder witness_key_circuit;
+        for (size_t i = 0; i < 2; ++i) {
+            RecursiveVerifier verifier{ &witness_key_circuit, instance->verification_key };
+            verifier.verify_proof(inner_proof);
+        }
+
+        OuterBuilder constant_key_circuit;
+        auto constant_key = VerificationKey::from_constants(&constant_key_circuit, instance->verification_key);
+        for (size_t i = 0; i < 2; ++i) {
+            RecursiveVerifier verifier{ &constant_key_circuit, constant_key };
+            auto pairing_points = verifier.verify_proof(inner_proof);
+            EXPECT_TRUE(native_verifier.key->pcs_verification_key->pairing_check(pairing_points[0].get_value(),
+                                                                                 pairing_points[1].get_value()));
+        }
+        info("Recursive Verifier Ultra x2: num gates = ",
+             witness_key_circuit.num_gates,
+             " with witness keys, ",
+             constant_key_circuit.num_gates,
+             " with a constant key");
+
+        EXPECT_EQ(constant_key->q_m.get_value(), instance->verification_key->q_m);
+        EXPECT_TRUE(constant_key->sigma_1.x.is_constant());
+        EXPECT_LT(constant_key_circuit.num_gates, witness_key_circuit.num_gates);
+        EXPECT_EQ(constant_key_circuit.failed(), false) << constant_key_circuit.err();
+        EXPECT_TRUE(constant_key_circuit.check_circuit());
+    }
+
     /**
      * @brief Construct a verifier circuit for a proof whose data has been tampered with. Expect failure
      * TODO(bberg #656): For now we get a "bad" proof by arbitrarily tampering with bits in a valid proof. It would be
@@ -256,6 +301,11 @@ HEAVY_TYPED_TEST(RecursiveVerifierTest, SingleRecursiveVerification)
     TestFixture::test_recursive_verification();
 };
 
+HEAVY_TYPED_TEST(RecursiveVerifierTest, RecursiveVerificationWithConstantKey)
+{
+    TestFixture::test_recursive_verification_with_constant_key();
+};
+
 HEAVY_TYPED_TEST(RecursiveVerifierTest, SingleRecursiveVerificationFailure)
 {
     TestFixture::test_recursive_verification_fails();
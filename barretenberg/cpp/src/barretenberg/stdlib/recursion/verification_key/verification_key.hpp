@@ -335,6 +335,20 @@ template <typename Curve> struct verification_key {
     }
 
     void validate_key_is_in_set(const std::vector<std::shared_ptr<plonk::verification_key>>& keys_in_set)
+    {
+        std::vector<bb::fr> key_hashes;
+        key_hashes.reserve(keys_in_set.size());
+        for (const auto& key : keys_in_set) {
+            key_hashes.emplace_back(hash_native(key));
+        }
+        validate_key_is_in_set(key_hashes);
+    }
+
+    /**
+     * @brief As above, but takes the `hash_native` of each key in the set. The native hashes only depend on the keys,
+     * so a circuit that checks against the same set many times can compute them once up front.
+     */
+    void validate_key_is_in_set(const std::vector<bb::fr>& key_hashes)
     {
         const auto circuit_key_compressed = hash();
         bool found = false;
@@ -342,8 +356,8 @@ template <typename Curve> struct verification_key {
         if constexpr (HasPlookup<Builder>) {
             field_t<Builder> key_index(witness_t<Builder>(context, 0));
             std::vector<field_t<Builder>> compressed_keys;
-            for (size_t i = 0; i < keys_in_set.size(); ++i) {
-                bb::fr compressed = hash_native(keys_in_set[i]);
+            for (size_t i = 0; i < key_hashes.size(); ++i) {
+                const bb::fr& compressed = key_hashes[i];
                 compressed_keys.emplace_back(compressed);
                 if (compressed == circuit_key_compressed.get_value()) {
                     key_index = witness_t<Builder>(context, i);
@@ -360,8 +374,7 @@ template <typename Curve> struct verification_key {
             output_key.assert_equal(circuit_key_compressed);
         } else {
             bool_t<Builder> is_valid(false);
-            for (const auto& key : keys_in_set) {
-                bb::fr compressed = hash_native(key);
+            for (const auto& compressed : key_hashes) {
                 is_valid = is_valid || (circuit_key_compressed == compressed);
             }
 
@@ -54,10 +54,16 @@ template <typename Flavor_, size_t NUM_ = 2> struct ProverInstances_ {
      * @param row_idx A fixed row position in several execution traces
      * @return The univariates whose extensions will be used to construct the combiner.
      */
-    auto row_to_univariates(size_t row_idx) const
+    auto row_to_univariates(size_t row_idx) const { return row_to_univariates(get_polynomials_views(), row_idx); }
+
+    /**
+     * @brief As above, but reading from views obtained once via get_polynomials_views(), so that a loop over many rows
+     * does not rebuild them for every row.
+     */
+    template <typename PolynomialsViews>
+    static auto row_to_univariates(const PolynomialsViews& insts_prover_polynomials_views, size_t row_idx)
     {
-        auto insts_prover_polynomials_views = get_polynomials_views();
-        std::array<Univariate<FF, NUM>, insts_prover_polynomials_views[0].size()> results;
+        std::array<Univariate<FF, NUM>, Flavor::NUM_ALL_ENTITIES> results;
         // Set the size corresponding to the number of rows in the execution trace
         size_t instance_idx = 0;
         // Iterate over the prover polynomials' views corresponding to each instance
@@ -71,8 +77,7 @@ template <typename Flavor_, size_t NUM_ = 2> struct ProverInstances_ {
         return results;
     }
 
-  private:
-    // Returns a vector containing pointer views to the prover polynomials corresponding to each instance.
+    // Returns an array containing pointer views to the prover polynomials corresponding to each instance.
     auto get_polynomials_views() const
     {
         // As a practical measure, get the first instance's view to deduce the array type
@@ -0,0 +1,134 @@
+#pragma once
+#include "barretenberg/crypto/blake3s_full/blake3s.hpp"
+#include "barretenberg/flavor/flavor.hpp"
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace bb {
+/**
+ * @brief A cache of the precomputed polynomials and verification keys of circuits, keyed by a hash of their structure
+ *
+ * @details The selectors, the sigma/id and table polynomials, the Lagrange polynomials and the commitments to all of
+ * them in the verification key depend only on the structure of a circuit, not on its witness. Prover instances
+ * constructed from structurally identical circuits (e.g. the kernel circuit accumulated over and over by ClientIVC)
+ * can therefore share this data by reference rather than recomputing it and committing to it again.
+ */
+template <class Flavor> class PrecomputedCache_ {
+    using Circuit = typename Flavor::CircuitBuilder;
+    using Polynomial = typename Flavor::Polynomial;
+    using VerificationKey = typename Flavor::VerificationKey;
+
+  public:
+    using Hash = std::array<uint8_t, blake3_full::BLAKE3_OUT_LEN>;
+
+    struct Entry {
+        // In the order of ProvingKey::get_precomputed_polynomials()
+        std::vector<Polynomial> polynomials;
+        std::shared_ptr<VerificationKey> verification_key;
+    };
+
+    /**
+     * @brief Hash everything the precomputed polynomials of a finalized circuit are derived from
+     * @details Wires enter the hash through the real index of their variables, so that two circuits hash to the same
+     * value iff they have the same selectors and copy constraints, regardless of their witness. Must be called before
+     * the public inputs block is populated by the execution trace.
+     *
+     * @param circuit
+     * @param dyadic_circuit_size
+     * @return Hash
+     */
+    static Hash compute_circuit_hash(Circuit& circuit, const size_t dyadic_circuit_size)
+    {
+        blake3_full::blake3_hasher hasher;
+        blake3_full::blake3_hasher_init(&hasher);
+        const auto absorb_size = [&](const size_t size) {
+            const auto value = static_cast<uint64_t>(size);
+            blake3_full::blake3_hasher_update(&hasher, &value, sizeof(value));
+        };
+        const auto absorb_indices = [&](const auto& indices) {
+            absorb_size(indices.size());
+            blake3_full::blake3_hasher_update(&hasher, indices.data(), indices.size() * sizeof(uint32_t));
+        };
+
+        absorb_size(dyadic_circuit_size);
+        std::vector<uint32_t> real_indices;
+        real_indices.reserve(circuit.public_inputs.size());
+        for (const uint32_t idx : circuit.public_inputs) {
+            real_indices.emplace_back(circuit.real_variable_index[idx]);
+        }
+        absorb_indices(real_indices);
+
+        for (auto& block : circuit.blocks.get()) {
+            absorb_size(block.size());
+            absorb_size(block.fixed_size);
+            for (const auto& wire : block.wires) {
+                real_indices.clear();
+                for (const uint32_t idx : wire) {
+                    real_indices.emplace_back(circuit.real_variable_index[idx]);
+                }
+                absorb_indices(real_indices);
+            }
+            for (const auto& selector : block.selectors) {
+                blake3_full::blake3_hasher_update(&hasher, selector.data(), selector.size() * sizeof(selector[0]));
+            }
+        }
+
+        // Generalized permutation tags
+        absorb_indices(circuit.real_variable_tags);
+        for (const auto& [tag, tau_tag] : circuit.tau) {
+            const std::array<uint32_t, 2> pair{ tag, tau_tag };
+            blake3_full::blake3_hasher_update(&hasher, pair.data(), sizeof(pair));
+        }
+
+        // The contents of a lookup table are determined by its id
+        for (const auto& table : circuit.lookup_tables) {
+            const auto id = static_cast<uint64_t>(table.id);
+            blake3_full::blake3_hasher_update(&hasher, &id, sizeof(id));
+            absorb_size(table.size);
+        }
+
+        if constexpr (IsGoblinFlavor<Flavor>) {
+            absorb_size(circuit.num_ecc_op_gates);
+        }
+
+        Hash hash;
+        blake3_full::blake3_hasher_finalize(&hasher, hash.data(), hash.size());
+        return hash;
+    }
+
+    std::shared_ptr<const Entry> find(const Hash& hash) const
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> lock(mutex);
+#endif
+        auto it = entries.find(hash);
+        return it == entries.end() ? nullptr : it->second;
+    }
+
+    void insert(const Hash& hash, std::shared_ptr<const Entry> entry)
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> lock(mutex);
+#endif
+        entries.emplace(hash, std::move(entry));
+    }
+
+    size_t size() const
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> lock(mutex);
+#endif
+        return entries.size();
+    }
+
+  private:
+#ifndef NO_MULTITHREADING
+    mutable std::mutex mutex;
+#endif
+    std::map<Hash, std::shared_ptr<const Entry>> entries;
+};
+
+} // namespace bb
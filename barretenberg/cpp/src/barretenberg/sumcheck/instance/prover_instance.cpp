@@ -22,6 +22,10 @@ template <class Flavor> size_t ProverInstance_<Flavor>::compute_dyadic_size(Circ
     if constexpr (IsGoblinFlavor<Flavor>) {
         min_size_of_execution_trace += circuit.num_ecc_op_gates;
     }
+    // a structured trace reserves the fixed size of every block, regardless of the size of the circuit
+    if (circuit.blocks.is_structured()) {
+        min_size_of_execution_trace = circuit.blocks.get_structured_size();
+    }
 
     // The number of gates is the maxmimum required by the lookup argument or everything else, plus an optional zero row
     // to allow for shifts.
@@ -89,10 +93,7 @@ template <class Flavor> void ProverInstance_<Flavor>::initialize_prover_polynomi
     std::span<FF> public_wires_source = prover_polynomials.w_r;
 
     // Determine public input offsets in the circuit relative to the 0th index for Ultra flavors
-    pub_inputs_offset = Flavor::has_zero_row ? 1 : 0;
-    if constexpr (IsGoblinFlavor<Flavor>) {
-        pub_inputs_offset += proving_key->num_ecc_op_gates;
-    }
+    pub_inputs_offset = proving_key->pub_inputs_offset;
     // Construct the public inputs array
     for (size_t i = 0; i < proving_key->num_public_inputs; ++i) {
         size_t idx = i + pub_inputs_offset;
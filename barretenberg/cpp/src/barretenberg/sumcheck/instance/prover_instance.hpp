@@ -6,6 +6,7 @@
 #include "barretenberg/proof_system/composer/permutation_lib.hpp"
 #include "barretenberg/proof_system/execution_trace/execution_trace.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/sumcheck/instance/precomputed_cache.hpp"
 
 namespace bb {
 /**
@@ -30,6 +31,7 @@ template <class Flavor> class ProverInstance_ {
     using RelationSeparator = typename Flavor::RelationSeparator;
 
     using Trace = ExecutionTrace_<Flavor>;
+    using PrecomputedCache = PrecomputedCache_<Flavor>;
 
   public:
     std::shared_ptr<ProvingKey> proving_key;
@@ -64,7 +66,16 @@ template <class Flavor> class ProverInstance_ {
     size_t instance_size;
     size_t log_instance_size;
 
-    ProverInstance_(Circuit& circuit)
+    /**
+     * @brief Construct a prover instance from a circuit
+     * @details If a cache is provided and already holds the precomputed polynomials and verification key of a
+     * structurally identical circuit, these are shared with the new instance and only the witness-dependent
+     * polynomials are constructed. Otherwise they are computed and, if a cache is provided, added to it.
+     *
+     * @param circuit
+     * @param precomputed_cache
+     */
+    ProverInstance_(Circuit& circuit, const std::shared_ptr<PrecomputedCache>& precomputed_cache = nullptr)
     {
         BB_OP_COUNT_TIME_NAME("ProverInstance(Circuit&)");
         circuit.add_gates_to_ensure_all_polys_are_non_zero();
@@ -72,19 +83,37 @@ template <class Flavor> class ProverInstance_ {
 
         dyadic_circuit_size = compute_dyadic_size(circuit);
 
+        typename PrecomputedCache::Hash circuit_hash{};
+        std::shared_ptr<const typename PrecomputedCache::Entry> precomputed;
+        if (precomputed_cache) {
+            circuit_hash = PrecomputedCache::compute_circuit_hash(circuit, dyadic_circuit_size);
+            precomputed = precomputed_cache->find(circuit_hash);
+        }
+
         proving_key = std::make_shared<ProvingKey>(dyadic_circuit_size, circuit.public_inputs.size());
 
-        // Construct and add to proving key the wire, selector and copy constraint polynomials
-        Trace::populate(circuit, proving_key);
+        if (precomputed) {
+            // Only the witness-dependent part of the trace needs to be constructed
+            Trace::populate_wires(circuit, proving_key);
+            for (auto [key_poly, cached_poly] :
+                 zip_view(proving_key->get_precomputed_polynomials(), precomputed->polynomials)) {
+                key_poly = cached_poly.share();
+            }
+        } else {
+            // Construct and add to proving key the wire, selector and copy constraint polynomials
+            Trace::populate(circuit, proving_key);
+        }
 
         // If Goblin, construct the databus polynomials
         if constexpr (IsGoblinFlavor<Flavor>) {
             construct_databus_polynomials(circuit);
         }
 
-        compute_first_and_last_lagrange_polynomials<Flavor>(proving_key.get());
+        if (!precomputed) {
+            compute_first_and_last_lagrange_polynomials<Flavor>(proving_key.get());
 
-        construct_table_polynomials(circuit, dyadic_circuit_size);
+            construct_table_polynomials(circuit, dyadic_circuit_size);
+        }
 
         proving_key->recursive_proof_public_input_indices = std::vector<uint32_t>(
             recursive_proof_public_input_indices.begin(), recursive_proof_public_input_indices.end());
@@ -92,7 +121,19 @@ template <class Flavor> class ProverInstance_ {
 
         sorted_polynomials = construct_sorted_list_polynomials<Flavor>(circuit, dyadic_circuit_size);
 
-        verification_key = std::make_shared<VerificationKey>(proving_key);
+        if (precomputed) {
+            verification_key = precomputed->verification_key;
+        } else {
+            verification_key = std::make_shared<VerificationKey>(proving_key);
+            if (precomputed_cache) {
+                auto entry = std::make_shared<typename PrecomputedCache::Entry>();
+                for (auto& poly : proving_key->get_precomputed_polynomials()) {
+                    entry->polynomials.emplace_back(poly.share());
+                }
+                entry->verification_key = verification_key;
+                precomputed_cache->insert(circuit_hash, std::move(entry));
+            }
+        }
         commitment_key = proving_key->commitment_key;
     }
 
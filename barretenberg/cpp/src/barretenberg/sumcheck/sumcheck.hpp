@@ -94,28 +94,55 @@ template <typename Flavor> class SumcheckProver {
         multivariate_challenge.reserve(multivariate_d);
 
         // First round
-        // This populates partially_evaluated_polynomials.
         auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
         transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
         FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
         multivariate_challenge.emplace_back(round_challenge);
-        partially_evaluate(full_polynomials, multivariate_n, round_challenge);
         pow_univariate.partially_evaluate(round_challenge);
         round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                  // release memory?        // All but final round
-        // We operate on partially_evaluated_polynomials in place.
+                                                  // release memory?
+        // All but final round
+        // Each subsequent round partially evaluates the previous round's multivariates at the previous challenge while
+        // computing its univariate. The second round populates partially_evaluated_polynomials from the full
+        // polynomials. Later rounds cannot fold in place, as threads fold rows that other threads still have to read, so
+        // they alternate with a buffer of n / 4 rows per polynomial. This costs 50% more sumcheck scratch memory than
+        // the n / 2 rows of partially_evaluated_polynomials alone.
+        PartiallyEvaluatedMultivariates partially_evaluated_buffer;
+        if (multivariate_d > 2) {
+            partially_evaluated_buffer = PartiallyEvaluatedMultivariates(multivariate_n >> 1);
+        }
         for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
-            round_univariate =
-                round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
+            if (round_idx == 1) {
+                round_univariate = round.partially_evaluate_and_compute_univariate(full_polynomials,
+                                                                                   partially_evaluated_polynomials,
+                                                                                   round_challenge,
+                                                                                   relation_parameters,
+                                                                                   pow_univariate,
+                                                                                   alpha);
+            } else {
+                round_univariate = round.partially_evaluate_and_compute_univariate(partially_evaluated_polynomials,
+                                                                                   partially_evaluated_buffer,
+                                                                                   round_challenge,
+                                                                                   relation_parameters,
+                                                                                   pow_univariate,
+                                                                                   alpha);
+                std::swap(partially_evaluated_polynomials, partially_evaluated_buffer);
+            }
             transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
-            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+            round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
             multivariate_challenge.emplace_back(round_challenge);
-            partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
             pow_univariate.partially_evaluate(round_challenge);
             round.round_size = round.round_size >> 1;
         }
 
+        // Partially evaluate the multivariates of the last round at its challenge
+        if (multivariate_d == 1) {
+            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+        } else {
+            partially_evaluate(partially_evaluated_polynomials, 2, round_challenge);
+        }
+
         // Final round: Extract multivariate evaluations from partially_evaluated_polynomials and add to transcript
         ClaimedEvaluations multivariate_evaluations;
         for (auto [eval, poly] :
@@ -76,6 +76,23 @@ template <typename Flavor> class SumcheckProverRound {
         Utils::zero_univariates(univariate_accumulators);
     }
 
+    /**
+     * @brief Extend an edge, given by its values at 0 and 1, to max-relation-length-many values.
+     *
+     * @details In the first rounds, most edges of the selectors, of the tables and of every polynomial past the end of
+     * the circuit are constant. These are filled with their value rather than extended, which keeps their extensions
+     * exactly zero where the edge is zero, as the relation skipping below relies on.
+     */
+    template <typename ExtendedEdge> static void extend_edge(ExtendedEdge& extended_edge, const FF& left, const FF& right)
+    {
+        if (left == right) {
+            std::fill(extended_edge.evaluations.begin(), extended_edge.evaluations.end(), left);
+        } else {
+            bb::Univariate<FF, 2> edge({ left, right });
+            extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+        }
+    }
+
     /**
      * @brief Extend each edge in the edge group at to max-relation-length-many values.
      *
@@ -89,8 +106,36 @@ template <typename Flavor> class SumcheckProverRound {
                       size_t edge_idx)
     {
         for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
-            bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
-            extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+            extend_edge(extended_edge, multivariate[edge_idx], multivariate[edge_idx + 1]);
+        }
+    }
+
+    /**
+     * @brief Partially evaluate the edge group of the previous round's multivariates that folds into the given edge
+     * group of this round, store the result and extend it.
+     *
+     * @details The edge (edge_idx, edge_idx + 1) of this round is obtained by evaluating the edges (2 * edge_idx, 2 *
+     * edge_idx + 1) and (2 * edge_idx + 2, 2 * edge_idx + 3) of the previous round at the previous challenge. The
+     * folded values are written to the multivariates of this round and extended straight from registers.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename PartiallyEvaluatedMultivariates>
+    void partially_evaluate_and_extend_edges(ExtendedEdges& extended_edges,
+                                             const ProverPolynomialsOrPartiallyEvaluatedMultivariates& previous,
+                                             PartiallyEvaluatedMultivariates& partially_evaluated,
+                                             const FF& previous_round_challenge,
+                                             size_t edge_idx)
+    {
+        const size_t previous_idx = edge_idx << 1;
+        for (auto [extended_edge, previous_poly, partially_evaluated_poly] :
+             zip_view(extended_edges.get_all(), previous.get_all(), partially_evaluated.get_all())) {
+            const FF left = previous_poly[previous_idx] +
+                            previous_round_challenge * (previous_poly[previous_idx + 1] - previous_poly[previous_idx]);
+            const FF right =
+                previous_poly[previous_idx + 2] +
+                previous_round_challenge * (previous_poly[previous_idx + 3] - previous_poly[previous_idx + 2]);
+            partially_evaluated_poly[edge_idx] = left;
+            partially_evaluated_poly[edge_idx + 1] = right;
+            extend_edge(extended_edge, left, right);
         }
     }
 
@@ -106,58 +151,39 @@ template <typename Flavor> class SumcheckProverRound {
         const bb::PowPolynomial<FF>& pow_polynomial,
         const RelationSeparator alpha)
     {
-        // Compute the constant contribution of pow polynomials for each edge. This is  the product of the partial
-        // evaluation result c_l (i.e. pow(u_0,...,u_{l-1})) where u_0,...,u_{l-1} are the verifier challenges from
-        // previous rounds) and the elements of pow(\vec{β}) not containing β_0,..., β_l.
-        std::vector<FF> pow_challenges(round_size >> 1);
-        pow_challenges[0] = pow_polynomial.partial_evaluation_result;
-        for (size_t i = 1; i < (round_size >> 1); ++i) {
-            pow_challenges[i] = pow_challenges[0] * pow_polynomial[i * pow_polynomial.periodicity];
-        }
-
-        // Determine number of threads for multithreading.
-        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
-        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
-
-        // Construct univariate accumulator containers; one per thread
-        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
-        for (auto& accum : thread_univariate_accumulators) {
-            Utils::zero_univariates(accum);
-        }
-
-        // Construct extended edge containers; one per thread
-        std::vector<ExtendedEdges> extended_edges;
-        extended_edges.resize(num_threads);
-
-        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
-        parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-
-                // Compute the i-th edge's univariate contribution,
-                // scale it by pow_challenge constant contribution and add it to the accumulators for Sˡ(Xₗ)
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_challenges[edge_idx >> 1]);
-            }
-        });
-
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
-        for (auto& accumulators : thread_univariate_accumulators) {
-            Utils::add_nested_tuples(univariate_accumulators, accumulators);
-        }
+        return accumulate_over_edges(
+            relation_parameters, pow_polynomial, alpha, [&](ExtendedEdges& extended_edges, size_t edge_idx) {
+                extend_edges(extended_edges, polynomials, edge_idx);
+            });
+    }
 
-        // Batch the univariate contributions from each sub-relation to obtain the round univariate
-        return batch_over_relations<bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>>(
-            univariate_accumulators, alpha, pow_polynomial);
+    /**
+     * @brief Partially evaluate the previous round's multivariates at the previous challenge and compute this round's
+     * univariate, in a single pass over the rows.
+     *
+     * @details Computing the univariate of a round only requires its edges, which are available as soon as they have
+     * been folded. Each thread folds and accumulates a contiguous range of edges, so that every value is read and
+     * written once per round, and all threads are used regardless of the number of polynomials. As the ranges of the
+     * threads overlap the rows they fold, the result must not be written in place: the previous multivariates are
+     * ProverPolynomials in round 1 and another PartiallyEvaluatedMultivariates afterwards.
+     *
+     * @param previous The multivariates of the previous round, of size 2 * round_size
+     * @param partially_evaluated Where to store the multivariates of this round, of size at least round_size
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename PartiallyEvaluatedMultivariates>
+    bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> partially_evaluate_and_compute_univariate(
+        const ProverPolynomialsOrPartiallyEvaluatedMultivariates& previous,
+        PartiallyEvaluatedMultivariates& partially_evaluated,
+        const FF& previous_round_challenge,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::PowPolynomial<FF>& pow_polynomial,
+        const RelationSeparator alpha)
+    {
+        return accumulate_over_edges(
+            relation_parameters, pow_polynomial, alpha, [&](ExtendedEdges& extended_edges, size_t edge_idx) {
+                partially_evaluate_and_extend_edges(
+                    extended_edges, previous, partially_evaluated, previous_round_challenge, edge_idx);
+            });
     }
 
     /**
@@ -217,6 +243,73 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    /**
+     * @brief Accumulate the contribution of each edge group of this round to the round univariate, over threads each
+     * handling a contiguous range of edges, then batch over the relations.
+     *
+     * @param extend Populates the extended edges of the edge group at a given index
+     */
+    template <typename ExtendEdges>
+    bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> accumulate_over_edges(
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::PowPolynomial<FF>& pow_polynomial,
+        const RelationSeparator& alpha,
+        const ExtendEdges& extend)
+    {
+        // Compute the constant contribution of pow polynomials for each edge. This is  the product of the partial
+        // evaluation result c_l (i.e. pow(u_0,...,u_{l-1})) where u_0,...,u_{l-1} are the verifier challenges from
+        // previous rounds) and the elements of pow(\vec{β}) not containing β_0,..., β_l.
+        std::vector<FF> pow_challenges(round_size >> 1);
+        pow_challenges[0] = pow_polynomial.partial_evaluation_result;
+        for (size_t i = 1; i < (round_size >> 1); ++i) {
+            pow_challenges[i] = pow_challenges[0] * pow_polynomial[i * pow_polynomial.periodicity];
+        }
+
+        // Determine number of threads for multithreading.
+        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
+        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
+        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
+        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
+        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+
+        // Construct univariate accumulator containers; one per thread
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+        for (auto& accum : thread_univariate_accumulators) {
+            Utils::zero_univariates(accum);
+        }
+
+        // Construct extended edge containers; one per thread
+        std::vector<ExtendedEdges> extended_edges;
+        extended_edges.resize(num_threads);
+
+        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            size_t start = thread_idx * iterations_per_thread;
+            size_t end = (thread_idx + 1) * iterations_per_thread;
+
+            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+                extend(extended_edges[thread_idx], edge_idx);
+
+                // Compute the i-th edge's univariate contribution,
+                // scale it by pow_challenge constant contribution and add it to the accumulators for Sˡ(Xₗ)
+                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                extended_edges[thread_idx],
+                                                relation_parameters,
+                                                pow_challenges[edge_idx >> 1]);
+            }
+        });
+
+        // Accumulate the per-thread univariate accumulators into a single set of accumulators
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+
+        // Batch the univariate contributions from each sub-relation to obtain the round univariate
+        return batch_over_relations<bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>>(
+            univariate_accumulators, alpha, pow_polynomial);
+    }
+
     /**
      * @brief For a given edge, calculate the contribution of each relation to the prover round univariate (S_l in the
      * thesis).
@@ -231,6 +324,11 @@ template <typename Flavor> class SumcheckProverRound {
      * Result: for each relation, a univariate of some degree is computed by accumulating the contributions of each
      * group of edges. These are stored in `univariate_accumulators`. Adding these univariates together, with
      * appropriate scaling factors, produces S_l.
+     *
+     * A relation whose gate selector vanishes on both ends of the edge contributes nothing and is not evaluated. Each
+     * gate type occupies a small part of the trace, so in the first rounds, which are the most expensive, most
+     * relations are skipped on most edges. In later rounds the folded selectors are rarely zero and the check exits on
+     * the first evaluation.
      */
     template <size_t relation_idx = 0>
     void accumulate_relation_univariates(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
@@ -239,8 +337,14 @@ template <typename Flavor> class SumcheckProverRound {
                                          const FF& scaling_factor)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        Relation::accumulate(
-            std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        bool skip_relation = false;
+        if constexpr (isSkippable<Relation, std::decay_t<decltype(extended_edges)>>) {
+            skip_relation = Relation::skip(extended_edges);
+        }
+        if (!skip_relation) {
+            Relation::accumulate(
+                std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
@@ -84,6 +84,10 @@ struct NativeTranscriptParams {
     {
         return bb::field_conversion::convert_to_bn254_frs(element);
     }
+    template <typename T> static inline void append_to_bn254_frs(const T& element, Proof& proof_data)
+    {
+        bb::field_conversion::append_to_bn254_frs(element, proof_data);
+    }
 };
 
 /**
@@ -115,7 +119,8 @@ template <typename TranscriptParams> class BaseTranscript {
 
   private:
     bool is_first_challenge = true; // indicates if this is the first challenge this transcript is generating
-    Fr previous_challenge{};        // default-initialized to zeros
+    // The input to the next challenge hash: the previous challenge (if there is one) followed by the data sent since.
+    // It is cleared rather than reallocated between rounds, so after the first few rounds no allocation happens here.
     std::vector<Fr> current_round_data;
 
     // "Manifest" object that records a summary of the transcript interactions
@@ -124,9 +129,8 @@ template <typename TranscriptParams> class BaseTranscript {
     /**
      * @brief Compute next challenge c_next = H( Compress(c_prev || round_buffer) )
      * @details This function computes a new challenge for the current round using the previous challenge
-     * and the current round data, if they are exist. It clears the current_round_data if nonempty after
-     * computing the challenge to minimize how much we compress. It also sets previous_challenge
-     * to the current challenge buffer to set up next function call.
+     * and the current round data, if they are exist. Both already live in current_round_data, which is hashed in
+     * place. It is then reset to hold just the new challenge, ready for the next call.
      * @return std::array<Fr, HASH_OUTPUT_SIZE>
      */
     [[nodiscard]] Fr get_next_challenge_buffer()
@@ -135,36 +139,24 @@ template <typename TranscriptParams> class BaseTranscript {
         // AND nothing was sent by the prover.
         if (is_first_challenge) {
             ASSERT(!current_round_data.empty());
+            is_first_challenge = false;
         }
 
-        // concatenate the previous challenge (if this is not the first challenge) with the current round data.
         // TODO(Adrian): Do we want to use a domain separator as the initial challenge buffer?
         // We could be cheeky and use the hash of the manifest as domain separator, which would prevent us from having
         // to domain separate all the data. (See https://safe-hash.dev)
-        std::vector<Fr> full_buffer;
-        if (!is_first_challenge) {
-            // if not the first challenge, we can use the previous_challenge
-            full_buffer.emplace_back(previous_challenge);
-        } else {
-            // Update is_first_challenge for the future
-            is_first_challenge = false;
-        }
-        if (!current_round_data.empty()) {
-            // TODO(https://github.com/AztecProtocol/barretenberg/issues/832): investigate why
-            // full_buffer.insert(full_buffer.end(), current_round_data.begin(), current_round_data.end()); fails to
-            // compile with gcc
-            std::copy(current_round_data.begin(), current_round_data.end(), std::back_inserter(full_buffer));
-            current_round_data.clear(); // clear the round data buffer since it has been used
-        }
 
         // Hash the full buffer with poseidon2, which is believed to be a collision resistant hash function and a random
         // oracle, removing the need to pre-hash to compress and then hash with a random oracle, as we previously did
         // with Pedersen and Blake3s.
-        Fr base_hash = TranscriptParams::hash(full_buffer);
-
-        Fr new_challenge = base_hash;
-        // update previous challenge buffer for next time we call this function
-        previous_challenge = new_challenge;
+        // Note: the sponge can't be kept alive across rounds to absorb data as it is sent, since the hash is a
+        // fixed-length hash whose IV encodes the length of the preimage. Only the previous challenge and the new data
+        // are hashed, so this is already proportional to the data sent this round.
+        Fr new_challenge = TranscriptParams::hash(current_round_data);
+
+        // the new challenge is the first input of the next hash
+        current_round_data.clear();
+        current_round_data.emplace_back(new_challenge);
         return new_challenge;
     };
 
@@ -195,8 +187,7 @@ template <typename TranscriptParams> class BaseTranscript {
      */
     template <typename T> void serialize_to_buffer(const T& element, Proof& proof_data)
     {
-        auto element_frs = TranscriptParams::template convert_to_bn254_frs(element);
-        proof_data.insert(proof_data.end(), element_frs.begin(), element_frs.end());
+        TranscriptParams::template append_to_bn254_frs(element, proof_data);
     }
     /**
      * @brief Deserializes the frs starting at offset into the typed element and returns that element.
@@ -306,16 +297,16 @@ template <typename TranscriptParams> class BaseTranscript {
         // TODO(Adrian): Ensure that serialization of affine elements (including point at infinity) is consistent.
         // TODO(Adrian): Consider restricting serialization (via concepts) to types T for which sizeof(T) reliably
         // returns the size of T in frs. (E.g. this is true for std::array but not for std::vector).
-        // convert element to field elements
-        auto element_frs = TranscriptParams::convert_to_bn254_frs(element);
-        proof_data.insert(proof_data.end(), element_frs.begin(), element_frs.end());
+        // convert element to field elements, written straight to the end of the proof
+        const size_t offset = proof_data.size();
+        TranscriptParams::append_to_bn254_frs(element, proof_data);
 
 #ifdef LOG_INTERACTIONS
         if constexpr (Loggable<T>) {
             info("sent:     ", label, ": ", element);
         }
 #endif
-        BaseTranscript::consume_prover_element_frs(label, element_frs);
+        BaseTranscript::consume_prover_element_frs(label, std::span{ proof_data }.subspan(offset));
     }
 
     /**
@@ -109,3 +109,43 @@ TEST(NativeTranscript, TwoProversTwoFields)
     EXPECT_STATE(verifier_transcript, /*start*/ 0, /*written*/ 37, /*read*/ 37);
     EXPECT_EQ(received_h, elt_h);
 }
+
+/**
+ * @brief Check that each challenge is the hash of the previous challenge followed by the data sent since
+ *
+ */
+TEST(NativeTranscript, ChallengesHashPreviousChallengeAndRoundData)
+{
+    const auto hash = [](const std::vector<Fr>& data) { return NativeTranscriptParams::hash(data); };
+
+    Transcript prover_transcript;
+    Fr elt_a = 1377;
+    prover_transcript.send_to_verifier("a", elt_a);
+    auto [alpha, beta] = prover_transcript.get_challenges<Fr>("alpha", "beta");
+
+    Fq elt_b = 773;
+    curve::BN254::AffineElement elt_c = bb::g1::affine_one;
+    prover_transcript.send_to_verifier("b", elt_b);
+    prover_transcript.send_to_verifier("c", elt_c);
+    auto gamma = prover_transcript.get_challenge<Fr>("gamma");
+    auto delta = prover_transcript.get_challenge<Fr>("delta");
+
+    EXPECT_EQ(alpha, hash({ elt_a }));
+    EXPECT_EQ(beta, hash({ alpha }));
+    std::vector<Fr> round_data{ beta };
+    for (const auto& frs :
+         { field_conversion::convert_to_bn254_frs(elt_b), field_conversion::convert_to_bn254_frs(elt_c) }) {
+        round_data.insert(round_data.end(), frs.begin(), frs.end());
+    }
+    EXPECT_EQ(gamma, hash(round_data));
+    EXPECT_EQ(delta, hash({ gamma }));
+
+    // the verifier derives the same challenges from the proof
+    Transcript verifier_transcript{ prover_transcript.export_proof() };
+    EXPECT_EQ(verifier_transcript.receive_from_prover<Fr>("a"), elt_a);
+    EXPECT_EQ(verifier_transcript.get_challenges<Fr>("alpha", "beta"), (std::array<Fr, 2>{ alpha, beta }));
+    EXPECT_EQ(verifier_transcript.receive_from_prover<Fq>("b"), elt_b);
+    EXPECT_EQ(verifier_transcript.receive_from_prover<curve::BN254::AffineElement>("c"), elt_c);
+    EXPECT_EQ(verifier_transcript.get_challenge<Fr>("gamma"), gamma);
+    EXPECT_EQ(verifier_transcript.get_challenge<Fr>("delta"), delta);
+}
@@ -26,10 +26,24 @@ namespace bb {
 
 void GoblinTranslatorComposer::compute_circuit_size_parameters(CircuitBuilder& circuit_builder)
 {
-    total_num_gates = std::max(circuit_builder.num_gates, MINIMUM_MINI_CIRCUIT_SIZE);
+    compute_circuit_size_parameters(circuit_builder.num_gates);
+}
+
+/**
+ * @brief Compute circuit size parameters from the number of gates alone
+ *
+ * @param num_gates The number of gates in the mini-circuit
+ */
+void GoblinTranslatorComposer::compute_circuit_size_parameters(const size_t num_gates)
+{
+    total_num_gates = std::max(num_gates, MINIMUM_MINI_CIRCUIT_SIZE);
 
     // Next power of 2
-    mini_circuit_dyadic_size = circuit_builder.get_circuit_subgroup_size(total_num_gates);
+    auto log2_n = static_cast<size_t>(numeric::get_msb(total_num_gates));
+    if ((1UL << log2_n) != total_num_gates) {
+        ++log2_n;
+    }
+    mini_circuit_dyadic_size = 1UL << log2_n;
 
     // The actual circuit size is several times bigger than the trace in the builder, because we use concatenation to
     // bring the degree of relations down, while extending the length.
@@ -179,6 +193,25 @@ void GoblinTranslatorComposer::compute_witness(CircuitBuilder& circuit_builder)
     computed_witness = true;
 }
 
+/**
+ * @brief Construct the witness-independent part of the proving key and the commitment key ahead of time
+ * @details The precomputed polynomials and the commitment key depend only on the size of the mini-circuit, which is
+ * known from the op queue before the ECCVM prover has produced the challenges needed to construct the circuit itself.
+ * This lets Goblin overlap this work with ECCVM proving. A subsequent call to create_prover reuses the results.
+ *
+ * @param num_gates The number of gates the translator circuit builder will contain
+ */
+void GoblinTranslatorComposer::precompute(const size_t num_gates)
+{
+    BB_OP_COUNT_TIME_NAME("GoblinTranslatorComposer::precompute");
+
+    compute_circuit_size_parameters(num_gates);
+
+    compute_precomputed_polynomials();
+
+    compute_commitment_key(proving_key->circuit_size);
+}
+
 /**
  * @brief Create a prover object (used to create the proof)
  *
@@ -195,6 +228,14 @@ GoblinTranslatorProver GoblinTranslatorComposer::create_prover(CircuitBuilder& c
     // Compute total number of gates, dyadic circuit size, etc.
     compute_circuit_size_parameters(circuit_builder);
 
+    // If precompute was given a gate count that disagrees with the builder, the key and commitment key it built have
+    // the wrong size; discard them so they are recomputed below
+    if (computed_precomputed_polynomials && proving_key->circuit_size != dyadic_circuit_size) {
+        proving_key = nullptr;
+        commitment_key = nullptr;
+        computed_precomputed_polynomials = false;
+    }
+
     // Compute non-witness polynomials
     compute_proving_key(circuit_builder);
 
@@ -242,11 +283,14 @@ GoblinTranslatorVerifier GoblinTranslatorComposer::create_verifier(const Circuit
 std::shared_ptr<typename Flavor::ProvingKey> GoblinTranslatorComposer::compute_proving_key(
     const CircuitBuilder& circuit_builder)
 {
-    if (proving_key) {
+    // A proving key provided on construction is used as is
+    if (proving_key && !computed_precomputed_polynomials) {
         return proving_key;
     }
 
-    proving_key = std::make_shared<ProvingKey>(dyadic_circuit_size);
+    // The precomputed polynomials may already have been constructed ahead of the circuit (see precompute), in which
+    // case only the challenges remain to be set
+    compute_precomputed_polynomials();
 
     // The input/challenge that we are evaluating all polynomials at
     proving_key->evaluation_input_x = circuit_builder.evaluation_input_x;
@@ -254,6 +298,21 @@ std::shared_ptr<typename Flavor::ProvingKey> GoblinTranslatorComposer::compute_p
     // The challenge for batching polynomials
     proving_key->batching_challenge_v = circuit_builder.batching_challenge_v;
 
+    return proving_key;
+}
+
+/**
+ * @brief Allocate the proving key and compute the polynomials that depend only on the circuit size
+ *
+ */
+void GoblinTranslatorComposer::compute_precomputed_polynomials()
+{
+    if (computed_precomputed_polynomials) {
+        return;
+    }
+
+    proving_key = std::make_shared<ProvingKey>(dyadic_circuit_size);
+
     // First and last lagrange polynomials (in the full circuit size)
     compute_first_and_last_lagrange_polynomials<Flavor>(proving_key.get());
 
@@ -265,7 +324,7 @@ std::shared_ptr<typename Flavor::ProvingKey> GoblinTranslatorComposer::compute_p
     // constraint
     bb::compute_extra_range_constraint_numerator<Flavor>(proving_key.get(), dyadic_circuit_size);
 
-    return proving_key;
+    computed_precomputed_polynomials = true;
 }
 
 /**
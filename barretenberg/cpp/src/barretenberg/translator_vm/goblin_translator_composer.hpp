@@ -35,6 +35,7 @@ class GoblinTranslatorComposer {
     std::shared_ptr<CommitmentKey> commitment_key;
 
     bool computed_witness = false;
+    bool computed_precomputed_polynomials = false;
     size_t total_num_gates = 0;          // num_gates (already include zero row offset) (used to compute dyadic size)
     size_t dyadic_circuit_size = 0;      // final power-of-2 circuit size
     size_t mini_circuit_dyadic_size = 0; // The size of the small circuit that contains non-range constraint relations
@@ -51,6 +52,9 @@ class GoblinTranslatorComposer {
     std::shared_ptr<VerificationKey> compute_verification_key(const CircuitBuilder& circuit_builder);
 
     void compute_circuit_size_parameters(CircuitBuilder& circuit_builder);
+    void compute_circuit_size_parameters(size_t num_gates);
+
+    void precompute(size_t num_gates);
 
     void compute_witness(CircuitBuilder& circuit_builder);
 
@@ -61,6 +65,10 @@ class GoblinTranslatorComposer {
         const CircuitBuilder& circuit_builder,
         const std::shared_ptr<Transcript>& transcript = std::make_shared<Transcript>());
 
+  private:
+    void compute_precomputed_polynomials();
+
+  public:
     std::shared_ptr<CommitmentKey> compute_commitment_key(size_t circuit_size)
     {
         if (commitment_key) {
@@ -7,6 +7,7 @@
 #include "barretenberg/translator_vm/goblin_translator_prover.hpp"
 
 #include <gtest/gtest.h>
+#include <optional>
 using namespace bb;
 
 namespace {
@@ -37,13 +38,12 @@ class GoblinTranslatorComposerTests : public ::testing::Test {
   protected:
     static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
 };
-} // namespace
 
 /**
- * @brief Test simple circuit with public inputs
- *
+ * @brief Construct a translator circuit with some random ops and prove/verify it, optionally after precomputing the
+ * proving key for a (possibly wrong) gate count
  */
-TEST_F(GoblinTranslatorComposerTests, Basic)
+bool prove_and_verify(const std::optional<size_t> precompute_num_gates = std::nullopt)
 {
     using G1 = g1::affine_element;
     using Fr = fr;
@@ -81,12 +81,33 @@ TEST_F(GoblinTranslatorComposerTests, Basic)
     EXPECT_TRUE(circuit_builder.check_circuit());
 
     auto composer = GoblinTranslatorComposer();
+    if (precompute_num_gates) {
+        composer.precompute(*precompute_num_gates);
+    }
     auto prover = composer.create_prover(circuit_builder, prover_transcript);
     auto proof = prover.construct_proof();
 
     auto verifier_transcript = std::make_shared<Transcript>(prover_transcript->proof_data);
     verifier_transcript->template receive_from_prover<Fq>("init");
     auto verifier = composer.create_verifier(circuit_builder, verifier_transcript);
-    bool verified = verifier.verify_proof(proof);
-    EXPECT_TRUE(verified);
+    return verifier.verify_proof(proof);
+}
+} // namespace
+
+/**
+ * @brief Test simple circuit with public inputs
+ *
+ */
+TEST_F(GoblinTranslatorComposerTests, Basic)
+{
+    EXPECT_TRUE(prove_and_verify());
+}
+
+/**
+ * @brief A key precomputed for a gate count that disagrees with the builder is discarded rather than used
+ *
+ */
+TEST_F(GoblinTranslatorComposerTests, PrecomputeWithWrongSizeIsRecomputed)
+{
+    EXPECT_TRUE(prove_and_verify(/*precompute_num_gates=*/1UL << 12));
 }
@@ -209,6 +209,86 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         EXPECT_EQ(perturbator[0], target_sum);
     }
 
+    /**
+     * @brief Check the full Honk evaluations and the perturbator on a trace where gate selectors vanish on most rows and
+     * the trailing rows are entirely zero, against a direct computation that evaluates every relation on every row.
+     *
+     */
+    static void test_pertubator_skipped_rows()
+    {
+        using RelationSeparator = typename Flavor::RelationSeparator;
+        using Utils = bb::RelationUtils<Flavor>;
+        const size_t log_instance_size(7);
+        const size_t instance_size(1 << log_instance_size);
+        const size_t active_size = instance_size / 2;
+        std::array<bb::Polynomial<FF>, Flavor::NUM_ALL_ENTITIES> random_polynomials;
+        for (auto& poly : random_polynomials) {
+            poly = bb::Polynomial<FF>(instance_size);
+            for (size_t i = 0; i < active_size; i++) {
+                poly[i] = FF::random_element();
+            }
+        }
+        auto full_polynomials = construct_full_prover_polynomials(random_polynomials);
+        // Each gate type is only present on a few rows
+        for (size_t i = 0; i < active_size; i++) {
+            if (i % 3 != 0) {
+                full_polynomials.q_arith[i] = 0;
+            }
+            if (i % 5 != 0) {
+                full_polynomials.q_elliptic[i] = 0;
+            }
+            if (i % 7 != 0) {
+                full_polynomials.q_aux[i] = 0;
+                full_polynomials.q_sort[i] = 0;
+            }
+        }
+        auto relation_parameters = bb::RelationParameters<FF>::get_random();
+        RelationSeparator alphas;
+        for (auto& alpha : alphas) {
+            alpha = FF::random_element();
+        }
+
+        auto full_honk_evals =
+            ProtoGalaxyProver::compute_full_honk_evaluations(full_polynomials, alphas, relation_parameters);
+
+        std::vector<FF> expected_honk_evals(instance_size);
+        FF linearly_dependent_contribution(0);
+        for (size_t i = 0; i < instance_size; i++) {
+            typename Flavor::TupleOfArraysOfValues relation_evaluations;
+            Utils::zero_elements(relation_evaluations);
+            Utils::template accumulate_relation_evaluations<>(
+                full_polynomials.get_row(i), relation_evaluations, relation_parameters, FF(1));
+            expected_honk_evals[i] = FF(0);
+            Utils::scale_and_batch_elements(
+                relation_evaluations, alphas, FF(1), expected_honk_evals[i], linearly_dependent_contribution);
+        }
+        expected_honk_evals[0] += linearly_dependent_contribution;
+        EXPECT_EQ(full_honk_evals, expected_honk_evals);
+
+        // The perturbator evaluated at X is the sum of f_i(ω) weighted by pow_i(\vec{β} + X\vec{δ})
+        std::vector<FF> betas(log_instance_size);
+        for (auto& beta : betas) {
+            beta = FF::random_element();
+        }
+        auto deltas = ProtoGalaxyProver::compute_round_challenge_pows(log_instance_size, FF::random_element());
+        auto perturbator = bb::Polynomial<FF>(
+            ProtoGalaxyProver::construct_perturbator_coefficients(betas, deltas, full_honk_evals));
+        EXPECT_EQ(perturbator.size(), log_instance_size + 1);
+
+        FF challenge = FF::random_element();
+        std::vector<FF> perturbed_betas(log_instance_size);
+        for (size_t idx = 0; idx < log_instance_size; idx++) {
+            perturbed_betas[idx] = betas[idx] + challenge * deltas[idx];
+        }
+        auto pow_perturbed_betas = bb::PowPolynomial(perturbed_betas);
+        pow_perturbed_betas.compute_values();
+        FF expected_evaluation(0);
+        for (size_t i = 0; i < instance_size; i++) {
+            expected_evaluation += full_honk_evals[i] * pow_perturbed_betas[i];
+        }
+        EXPECT_EQ(perturbator.evaluate(challenge), expected_evaluation);
+    }
+
     /**
      * @brief Manually compute the expected evaluations of the combiner quotient, given evaluations of the combiner and
      * check them against the evaluations returned by the function.
@@ -324,6 +404,87 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         decide_and_verify(prover_accumulator_2, verifier_accumulator_2, composer, true);
     }
 
+    /**
+     * @brief Fold several instances into an accumulator at once, then fold the result with further instances, and
+     * check that the final accumulator is decided correctly.
+     *
+     */
+    static void test_full_protogalaxy_multiple_instances()
+    {
+        constexpr size_t NUM_INSTANCES = 4;
+        using MultipleProverInstances = ProverInstances_<Flavor, NUM_INSTANCES>;
+        using MultipleVerifierInstances = VerifierInstances_<Flavor, NUM_INSTANCES>;
+        auto composer = Composer();
+
+        const auto construct_instances = [&](std::vector<std::shared_ptr<ProverInstance>>& prover_instances,
+                                             std::vector<std::shared_ptr<VerifierInstance>>& verifier_instances) {
+            while (prover_instances.size() < NUM_INSTANCES) {
+                auto builder = typename Flavor::CircuitBuilder();
+                construct_circuit(builder);
+                prover_instances.emplace_back(composer.create_prover_instance(builder));
+                verifier_instances.emplace_back(composer.create_verifier_instance(prover_instances.back()));
+            }
+        };
+        const auto fold_and_verify_multiple = [](const std::vector<std::shared_ptr<ProverInstance>>& prover_instances,
+                                                 const std::vector<std::shared_ptr<VerifierInstance>>&
+                                                     verifier_instances) {
+            ProtoGalaxyProver_<MultipleProverInstances> folding_prover(prover_instances);
+            ProtoGalaxyVerifier_<MultipleVerifierInstances> folding_verifier(verifier_instances);
+
+            auto [prover_accumulator, folding_proof] = folding_prover.fold_instances();
+            auto verifier_accumulator = folding_verifier.verify_folding_proof(folding_proof);
+            return std::make_tuple(prover_accumulator, verifier_accumulator);
+        };
+
+        std::vector<std::shared_ptr<ProverInstance>> prover_instances;
+        std::vector<std::shared_ptr<VerifierInstance>> verifier_instances;
+        construct_instances(prover_instances, verifier_instances);
+        auto [prover_accumulator, verifier_accumulator] =
+            fold_and_verify_multiple(prover_instances, verifier_instances);
+        check_accumulator_target_sum_manual(prover_accumulator, true);
+
+        std::vector<std::shared_ptr<ProverInstance>> prover_instances_2{ prover_accumulator };
+        std::vector<std::shared_ptr<VerifierInstance>> verifier_instances_2{ verifier_accumulator };
+        construct_instances(prover_instances_2, verifier_instances_2);
+        auto [prover_accumulator_2, verifier_accumulator_2] =
+            fold_and_verify_multiple(prover_instances_2, verifier_instances_2);
+        check_accumulator_target_sum_manual(prover_accumulator_2, true);
+
+        decide_and_verify(prover_accumulator_2, verifier_accumulator_2, composer, true);
+    }
+
+    /**
+     * @brief Fold circuits of different sizes laid out in a structured trace, which gives them the same dyadic size and
+     * block offsets.
+     *
+     */
+    static void test_full_protogalaxy_structured_trace()
+    {
+        auto composer = Composer();
+        auto builder_1 = typename Flavor::CircuitBuilder();
+        construct_circuit(builder_1);
+        builder_1.blocks.set_fixed_block_sizes(TraceStructure::SMALL_TEST);
+
+        auto builder_2 = typename Flavor::CircuitBuilder();
+        construct_circuit(builder_2);
+        construct_circuit(builder_2);
+        builder_2.blocks.set_fixed_block_sizes(TraceStructure::SMALL_TEST);
+
+        auto prover_instance_1 = composer.create_prover_instance(builder_1);
+        auto prover_instance_2 = composer.create_prover_instance(builder_2);
+        EXPECT_EQ(prover_instance_1->proving_key->circuit_size, prover_instance_2->proving_key->circuit_size);
+        EXPECT_EQ(prover_instance_1->proving_key->pub_inputs_offset, prover_instance_2->proving_key->pub_inputs_offset);
+
+        auto verifier_instance_1 = composer.create_verifier_instance(prover_instance_1);
+        auto verifier_instance_2 = composer.create_verifier_instance(prover_instance_2);
+        auto [prover_accumulator, verifier_accumulator] = fold_and_verify(
+            { prover_instance_1, prover_instance_2 }, { verifier_instance_1, verifier_instance_2 }, composer);
+
+        check_accumulator_target_sum_manual(prover_accumulator, true);
+
+        decide_and_verify(prover_accumulator, verifier_accumulator, composer, true);
+    }
+
     /**
      * @brief Ensure tampering a commitment and then calling the decider causes the decider verification to fail.
      *
@@ -414,6 +575,11 @@ TYPED_TEST(ProtoGalaxyTests, PerturbatorPolynomial)
     TestFixture::test_pertubator_polynomial();
 }
 
+TYPED_TEST(ProtoGalaxyTests, PerturbatorSkippedRows)
+{
+    TestFixture::test_pertubator_skipped_rows();
+}
+
 TYPED_TEST(ProtoGalaxyTests, CombinerQuotient)
 {
     TestFixture::test_combiner_quotient();
@@ -434,6 +600,16 @@ TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyTest)
     TestFixture::test_full_protogalaxy();
 }
 
+TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyMultipleInstances)
+{
+    TestFixture::test_full_protogalaxy_multiple_instances();
+}
+
+TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyStructuredTrace)
+{
+    TestFixture::test_full_protogalaxy_structured_trace();
+}
+
 TYPED_TEST(ProtoGalaxyTests, TamperedCommitment)
 {
     TestFixture::test_tampered_commitment();
@@ -7,9 +7,10 @@
 namespace bb {
 
 template <IsUltraFlavor Flavor>
-std::shared_ptr<ProverInstance_<Flavor>> UltraComposer_<Flavor>::create_prover_instance(CircuitBuilder& circuit)
+std::shared_ptr<ProverInstance_<Flavor>> UltraComposer_<Flavor>::create_prover_instance(
+    CircuitBuilder& circuit, const std::shared_ptr<PrecomputedCache>& precomputed_cache)
 {
-    return std::make_shared<ProverInstance>(circuit);
+    return std::make_shared<ProverInstance>(circuit, precomputed_cache);
 }
 
 template <IsUltraFlavor Flavor>
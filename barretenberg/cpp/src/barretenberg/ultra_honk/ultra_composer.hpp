@@ -25,7 +25,10 @@ template <IsUltraFlavor Flavor_> class UltraComposer_ {
     using ProverInstances = ProverInstances_<Flavor>;
     using VerifierInstances = VerifierInstances_<Flavor>;
 
-    std::shared_ptr<ProverInstance> create_prover_instance(CircuitBuilder&);
+    using PrecomputedCache = PrecomputedCache_<Flavor>;
+
+    std::shared_ptr<ProverInstance> create_prover_instance(
+        CircuitBuilder&, const std::shared_ptr<PrecomputedCache>& precomputed_cache = nullptr);
 
     /**
      * @brief Create a verifier instance object.
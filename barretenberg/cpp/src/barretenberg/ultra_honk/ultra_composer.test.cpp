@@ -113,6 +113,85 @@ TEST_F(UltraHonkComposerTests, PublicInputs)
     prove_and_verify(builder, composer, /*expected_result=*/true);
 }
 
+/**
+ * @brief Check that batch verification accepts valid proofs for the same verification key, and rejects the batch as
+ * soon as it contains an invalid proof
+ */
+TEST_F(UltraHonkComposerTests, BatchVerifyProofs)
+{
+    constexpr size_t num_valid_proofs = 3;
+    auto composer = UltraComposer();
+    std::vector<HonkProof> proofs;
+    std::shared_ptr<UltraFlavor::VerificationKey> verification_key;
+    for (size_t i = 0; i < num_valid_proofs + 1; ++i) {
+        // Circuits of identical structure, the last one with a witness that does not satisfy the multiplication gate
+        auto circuit_builder = UltraCircuitBuilder();
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        fr c = (i < num_valid_proofs) ? a * b : fr::random_element();
+        auto indices = add_variables(circuit_builder, { a, b, c });
+        circuit_builder.create_mul_gate({ indices[0], indices[1], indices[2], 1, -1, 0 });
+
+        auto instance = composer.create_prover_instance(circuit_builder);
+        auto prover = composer.create_prover(instance);
+        proofs.emplace_back(prover.construct_proof());
+        verification_key = instance->verification_key;
+    }
+
+    auto verifier = composer.create_verifier(verification_key);
+    EXPECT_TRUE(verifier.batch_verify_proofs(std::span(proofs).first(num_valid_proofs)));
+    EXPECT_FALSE(verifier.batch_verify_proofs(proofs));
+}
+
+/**
+ * @brief Check that instances of structurally identical circuits share their precomputed polynomials and verification
+ * key through the cache, and that instances of a different circuit do not
+ */
+TEST_F(UltraHonkComposerTests, PrecomputedCache)
+{
+    auto composer = UltraComposer();
+    auto cache = std::make_shared<UltraComposer::PrecomputedCache>();
+    const auto create_instance = [&](size_t num_xors, bool use_cache) {
+        auto circuit_builder = UltraCircuitBuilder();
+        circuit_builder.add_public_variable(fr::random_element());
+        for (size_t i = 0; i < num_xors; ++i) {
+            fr left = engine.get_random_uint32();
+            fr right = engine.get_random_uint32();
+            uint32_t left_idx = circuit_builder.add_variable(left);
+            uint32_t right_idx = circuit_builder.add_variable(right);
+            const auto accumulators =
+                plookup::get_lookup_accumulators(plookup::MultiTableId::UINT32_XOR, left, right, true);
+            circuit_builder.create_gates_from_plookup_accumulators(
+                plookup::MultiTableId::UINT32_XOR, accumulators, left_idx, right_idx);
+            circuit_builder.decompose_into_default_range(left_idx, 32);
+        }
+        return composer.create_prover_instance(circuit_builder, use_cache ? cache : nullptr);
+    };
+
+    auto first = create_instance(2, true);
+    auto second = create_instance(2, true);
+    auto other = create_instance(3, true);
+    auto uncached = create_instance(2, false);
+    EXPECT_EQ(cache->size(), 2);
+
+    EXPECT_EQ(first->verification_key, second->verification_key);
+    EXPECT_NE(first->verification_key, other->verification_key);
+    for (auto [first_poly, second_poly] : zip_view(first->proving_key->get_precomputed_polynomials(),
+                                                   second->proving_key->get_precomputed_polynomials())) {
+        EXPECT_EQ(first_poly.data(), second_poly.data());
+    }
+    for (auto [cached, expected] :
+         zip_view(second->verification_key->get_all(), uncached->verification_key->get_all())) {
+        EXPECT_EQ(cached, expected);
+    }
+
+    for (auto& instance : { first, second, other }) {
+        auto prover = composer.create_prover(instance);
+        auto verifier = composer.create_verifier(instance->verification_key);
+        EXPECT_TRUE(verifier.verify_proof(prover.construct_proof()));
+    }
+}
+
 TEST_F(UltraHonkComposerTests, XorConstraint)
 {
     auto circuit_builder = UltraCircuitBuilder();
@@ -1,5 +1,6 @@
 #include "./ultra_verifier.hpp"
 #include "barretenberg/commitment_schemes/zeromorph/zeromorph.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
@@ -36,10 +37,13 @@ template <typename Flavor> UltraVerifier_<Flavor>& UltraVerifier_<Flavor>::opera
 }
 
 /**
- * @brief This function verifies an Ultra Honk proof for a given Flavor.
+ * @brief Run the verifier on an Ultra Honk proof up to the final pairing check
  *
+ * @return The inputs to the final pairing check, or nullopt if the proof is rejected before reaching it
  */
-template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkProof& proof)
+template <typename Flavor>
+std::optional<std::array<typename Flavor::Commitment, 2>> UltraVerifier_<Flavor>::compute_pairing_points(
+    const HonkProof& proof)
 {
     using FF = typename Flavor::FF;
     using Commitment = typename Flavor::Commitment;
@@ -61,10 +65,10 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
     const auto pub_inputs_offset = transcript->template receive_from_prover<uint32_t>("pub_inputs_offset");
 
     if (circuit_size != key->circuit_size) {
-        return false;
+        return std::nullopt;
     }
     if (public_input_size != key->num_public_inputs) {
-        return false;
+        return std::nullopt;
     }
 
     std::vector<FF> public_inputs;
@@ -138,23 +142,69 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
     auto [multivariate_challenge, claimed_evaluations, sumcheck_verified] =
         sumcheck.verify(relation_parameters, alphas, gate_challenges);
 
-    // If Sumcheck did not verify, return false
-    if (sumcheck_verified.has_value() && !sumcheck_verified.value()) {
-        return false;
+    // If Sumcheck did not verify, return nullopt
+    if (!sumcheck_verified.value()) {
+        return std::nullopt;
     }
 
     // Execute ZeroMorph rounds. See https://hackmd.io/dlf9xEwhTQyE3hiGbq4FsA?view for a complete description of the
     // unrolled protocol.
-    auto pairing_points = ZeroMorph::verify(commitments.get_unshifted(),
-                                            commitments.get_to_be_shifted(),
-                                            claimed_evaluations.get_unshifted(),
-                                            claimed_evaluations.get_shifted(),
-                                            multivariate_challenge,
-                                            transcript);
+    return ZeroMorph::verify(commitments.get_unshifted(),
+                             commitments.get_to_be_shifted(),
+                             claimed_evaluations.get_unshifted(),
+                             claimed_evaluations.get_shifted(),
+                             multivariate_challenge,
+                             transcript);
+}
 
-    auto verified = key->pcs_verification_key->pairing_check(pairing_points[0], pairing_points[1]);
+/**
+ * @brief This function verifies an Ultra Honk proof for a given Flavor.
+ *
+ */
+template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkProof& proof)
+{
+    auto pairing_points = compute_pairing_points(proof);
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    return key->pcs_verification_key->pairing_check((*pairing_points)[0], (*pairing_points)[1]);
+}
 
-    return sumcheck_verified.value() && verified;
+/**
+ * @brief Verify several Ultra Honk proofs for the verification key of this verifier with a single pairing check
+ * @details Each proof is reduced to its pairing points and the pairing equations are then checked as a random linear
+ * combination, see VerifierCommitmentKey::batch_pairing_check. The reductions are independent and are spread over the
+ * available cpus, each with its own verifier (and hence transcript) sharing the verification key.
+ */
+template <typename Flavor> bool UltraVerifier_<Flavor>::batch_verify_proofs(std::span<const HonkProof> proofs)
+{
+    const size_t num_proofs = proofs.size();
+    std::vector<std::optional<std::array<Commitment, 2>>> proof_pairing_points(num_proofs);
+
+    const auto reduce_proofs = [&](size_t start, size_t end) {
+        UltraVerifier_ verifier{ key };
+        for (size_t i = start; i < end; ++i) {
+            proof_pairing_points[i] = verifier.compute_pairing_points(proofs[i]);
+        }
+    };
+    const size_t num_tasks = std::min(get_num_cpus(), num_proofs);
+    std::vector<BudgetedTask> tasks;
+    for (size_t task_idx = 0; task_idx < num_tasks; ++task_idx) {
+        const size_t start = task_idx * num_proofs / num_tasks;
+        const size_t end = (task_idx + 1) * num_proofs / num_tasks;
+        tasks.push_back({ 1, [&reduce_proofs, start, end]() { reduce_proofs(start, end); } });
+    }
+    run_tasks_concurrently(tasks);
+
+    std::vector<std::array<Commitment, 2>> pairing_points;
+    pairing_points.reserve(num_proofs);
+    for (const auto& points : proof_pairing_points) {
+        if (!points.has_value()) {
+            return false;
+        }
+        pairing_points.emplace_back(*points);
+    }
+    return key->pcs_verification_key->batch_pairing_check(pairing_points);
 }
 
 template class UltraVerifier_<UltraFlavor>;
@@ -24,7 +24,9 @@ template <typename Flavor> class UltraVerifier_ {
     UltraVerifier_& operator=(const UltraVerifier_& other) = delete;
     UltraVerifier_& operator=(UltraVerifier_&& other);
 
+    std::optional<std::array<Commitment, 2>> compute_pairing_points(const HonkProof& proof);
     bool verify_proof(const HonkProof& proof);
+    bool batch_verify_proofs(std::span<const HonkProof> proofs);
 
     std::shared_ptr<VerificationKey> key;
     std::map<std::string, Commitment> commitments;